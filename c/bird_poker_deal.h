@@ -0,0 +1,118 @@
+#ifndef bird_poker_DEAL_H_
+#define bird_poker_DEAL_H_
+
+// Dealing of the face from one random number per deal or redraw.
+//
+// With n cards left, the count cards dealt in order have N = n (n - 1) ... (n - count + 1) outcomes,
+// at most 17 16 15 14 13 = 742560 for a deal and 12 11 10 9 8 = 95040 for a redraw. One r uniform in [0, N)
+// is read as mixed radix digits r % n, r / n % (n - 1), ...: a bijection from [0, N) onto the ordered draws,
+// so every draw has probability 1 / N. Digit d picks the d-th card left.
+
+#include <stdint.h>
+#include "bird_poker_rng.h"
+
+#define DECK_MASK 0x3FFFEu // cards CA 1 to WK 17
+
+// r / n is (r * DEAL_RECIPROCALS[n]) >> 40 for r < 2^24 and n <= 17: ceil(2^40 / n) is off by
+// less than n / 2^40, too little to reach the next multiple of n. Saves a division per card.
+#define DEAL_RECIPROCAL(n) ((((uint64_t) 1 << 40) + (n) - 1) / (n))
+static const uint64_t DEAL_RECIPROCALS[18] = {
+    0, DEAL_RECIPROCAL(1), DEAL_RECIPROCAL(2), DEAL_RECIPROCAL(3), DEAL_RECIPROCAL(4), DEAL_RECIPROCAL(5),
+    DEAL_RECIPROCAL(6), DEAL_RECIPROCAL(7), DEAL_RECIPROCAL(8), DEAL_RECIPROCAL(9), DEAL_RECIPROCAL(10),
+    DEAL_RECIPROCAL(11), DEAL_RECIPROCAL(12), DEAL_RECIPROCAL(13), DEAL_RECIPROCAL(14), DEAL_RECIPROCAL(15),
+    DEAL_RECIPROCAL(16), DEAL_RECIPROCAL(17),
+};
+
+// running bit counts of a mask for select_bit: the set bits of every pair, nibble, and byte, and byte i of sums
+// the set bits of bytes 0 to i, so the top byte counts all of mask
+typedef struct {
+    uint32_t mask;
+    uint32_t pairs;
+    uint32_t nibbles;
+    uint32_t sums;
+} bit_counts_t;
+
+static inline bit_counts_t count_bits(uint32_t mask) {
+    bit_counts_t counts = {.mask = mask};
+    counts.pairs = mask - ((mask >> 1) & 0x55555555u);
+    counts.nibbles = (counts.pairs & 0x33333333u) + ((counts.pairs >> 2) & 0x33333333u);
+    counts.sums = ((counts.nibbles + (counts.nibbles >> 4)) & 0x0F0F0F0Fu) * 0x01010101u;
+    return counts;
+}
+
+// the position of the k-th (from 0) set bit of the mask, it has more than k bits set. Without pdep it narrows
+// down from bytes to nibbles to pairs of bits on the counts, no branches: a loop over the bits mispredicts on
+// every card and made up most of the time of a deal.
+static inline uint8_t select_bit(const bit_counts_t *counts, uint8_t k) {
+#if defined(__BMI2__)
+    return __builtin_ctz(__builtin_ia32_pdep_si(1u << k, counts->mask));
+#else
+    // the bytes whose sum is at most k are the ones below the bit
+    uint32_t below = ~((counts->sums | 0x80808080u) - (k + 1) * 0x01010101u) & 0x80808080u;
+    uint8_t shift = (((below >> 7) * 0x01010101u) >> 24) * 8;
+    k -= ((counts->sums << 8) >> shift) & 0xFF;
+    uint8_t count = (counts->nibbles >> shift) & 0xF;
+    uint8_t up = k >= count;
+    shift += up * 4;
+    k -= up * count;
+    count = (counts->pairs >> shift) & 0x3;
+    up = k >= count;
+    shift += up * 2;
+    k -= up * count;
+    return shift + ((k | ~(counts->mask >> shift)) & 1);
+#endif
+}
+
+// count (up to 5) cards to deal from the ones not dealt, to deal them again for every hand of a multi hand deal
+typedef struct {
+    bit_counts_t left;
+    uint8_t count;
+    uint32_t outcomes;
+} deal_t;
+
+static inline void deal_init(deal_t *deal, uint32_t dealt, uint8_t count) {
+    deal->left = count_bits(DECK_MASK & ~dealt);
+    deal->count = count;
+    deal->outcomes = 1;
+    uint8_t n = deal->left.sums >> 24;
+    for (uint8_t i = 0; i < count; i++) {
+        deal->outcomes *= n - i;
+    }
+}
+
+// deals the cards into cards[], in order, returns their mask
+static inline uint32_t deal_draw(const deal_t *deal, bird_poker_rng_t *rng, uint8_t cards[5]) {
+    if (deal->count == 0) {
+        return 0;
+    }
+    uint32_t r = bird_poker_rng_below(rng, deal->outcomes);
+    uint8_t n = deal->left.sums >> 24;
+    uint8_t at[5];
+    for (uint8_t i = 0; i < deal->count; i++, n--) {
+        uint32_t q = (r * DEAL_RECIPROCALS[n]) >> 40;
+        at[i] = r - q * n;
+        r = q;
+    }
+    // at[i] counts among the cards left after the ones before it, from the back it is moved past each of them
+    // to count among all of left, so the cards are picked from left independently of each other
+    for (int8_t i = deal->count - 2; i >= 0; i--) {
+        for (uint8_t j = i + 1; j < deal->count; j++) {
+            at[j] += at[j] >= at[i];
+        }
+    }
+    uint32_t drawn = 0;
+    for (uint8_t i = 0; i < deal->count; i++) {
+        cards[i] = select_bit(&deal->left, at[i]);
+        drawn |= 1u << cards[i];
+    }
+    return drawn;
+}
+
+// deals count (up to 5) cards that are not in *dealt into cards[], in order, and adds them to *dealt
+static inline void deal_cards(bird_poker_rng_t *rng, uint32_t *dealt, uint8_t count, uint8_t cards[5]) {
+    deal_t deal;
+    deal_init(&deal, *dealt, count);
+    *dealt |= deal_draw(&deal, rng, cards);
+}
+
+#endif // bird_poker_DEAL_H_
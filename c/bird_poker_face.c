@@ -1,17 +1,25 @@
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #if __EMSCRIPTEN__
 #include <time.h> // to seed random in emulator
 #endif
 #include "bird_poker_face.h"
 #include "watch_private_display.h"
+#include "bird_poker_score.h"
+#include "bird_poker_score_table.h"
+#include "bird_poker_glyph_table.h"
+#include "bird_poker_deal.h"
+#include "bird_poker_hands.h"
+#include "bird_poker_hold_table.h"
+#include "bird_poker_save.h"
+#include "bird_poker_log.h"
 
 #define SCREEN_WELCOME 10
 #define SCREEN_WELCOME_BALANCE 11
 #define SCREEN_WELCOME_COMBO_ROYAL 12
 #define SCREEN_WELCOME_COMBOS 13
 #define SCREEN_WELCOME_CARDS 14
+#define SCREEN_WELCOME_HANDS 15
 #define SCREEN_DEAL 20
 #define SCREEN_SELECT 30
 #define SCREEN_REDRAW 40
@@ -19,255 +27,82 @@
 #define SCREEN_SETTLE_PRIZE 51
 #define SCREEN_SETTLE_BALANCE 52
 #define SCREEN_SETTLE_JACKPOT 53
+#define SCREEN_SETTLE_COMBOS 54
 #define SCREEN_BUST 60
 
 #define EV_INIT 1
 #define EV_TOP_LEFT 2
 #define EV_BOTTOM_RIGHT 3
 #define EV_TICK 4
-
-#define Royal 9
-#define FiveK 8
-#define StrFl 7
-#define FourK 6
-#define Strgt 5
-#define Flush 4
-#define Trips 3
-#define OnePr 2
-#define HighC 1
-
-const uint8_t PAYOUTS_LENGTH = 9;
-const char* const PAYOUTS_NAMES[] = {"  ", "H1", "P ", "3K", "FL", "St", "4K", "SF", "5K", "rF"};
-const uint8_t PAYOUTS_PRIZES[] = {0, 0, 0, 1, 2, 3, 4, 10, 30, 250};
-
-#define CA 1
-#define C2 2
-#define C3 3
-#define C4 4
-#define C5 5
-#define C6 6
-#define C7 7
-#define C8 8
-#define C9 9
-#define CT 10
-#define CJ 11
-#define CQ 12
-#define CK 13
-#define W4 14
-#define W7 15
-#define WT 16
-#define WK 17
-// CAHigh only used in output, not in hnd, doesn't clash with W4
-#define CAHigh 14
+#define EV_BOTTOM_RIGHT_LONG 5
+#define EV_RESUME 6
 
 // A a, 2, 3, 4, 5, 6, 7, 8, 9, T, J, Q, K, W4 f, W7 r, WT t, WK k
 const char CARD_CHARS[] = {' ', 'H', '2', '3', '4', '5', '6', '7', '8', '9', 'T', 'J', 'Q', 'K', 'f', 'r', 't', 'k'};
 
-int is_wild(int);
-inline int is_wild(int c) {
-   return c >= W4;
-}
-
-int wildcard_rank(int);
-inline int wildcard_rank(int c) {
-   if (c == W4) {
-      return 4;
-   } else if (c == W7) {
-      return 7;
-   } else if (c == WT) {
-      return 10;
-   } else if (c == WK) {
-      return 13;
-   } else {
-      return c;
-   }
-}
 
+// Shadow of the LCD, one bit per segment of COM0-2 as watch_set_pixel takes them. Handlers draw into frame,
+// commitFrame writes only the segments that differ from what is on the LCD (frame_shown).
+static uint32_t frame[3];
+static uint32_t frame_shown[3];
 
-static void handsort(int hnd[]) {
-   int i = 0;
-   int j = 0;
-   int swap = 0;
-   for (i = 0; i < 4; i++) {
-      swap = 0; // card is never 0
-      for (j = 0; j < 4 - i; j++) {
-         if (hnd[j] > hnd[j+1]) {
-            swap = hnd[j+1];
-            hnd[j+1] = hnd[j];
-            hnd[j] = swap;
-         }
-      }
-      if (!swap) {
-         break;
-      }
-   }
+static void clearFrame(void) {
+    frame[0] = 0;
+    frame[1] = 0;
+    frame[2] = 0;
 }
 
-// hnd is sorted
-static int highcard(int hnd[], int wildcard_count) {
-   if (hnd[0] == CA) {
-      return CAHigh;
-   } else {
-      int highc = hnd[4];
-      if (highc >= W4) {
-        highc = wildcard_rank(highc);
-        // check if the highest non-wildcard is better
-        if (hnd[4 - wildcard_count] > highc) {
-          highc = hnd[4 - wildcard_count];
+static void commitFrame(void) {
+    for (uint8_t com = 0; com < 3; com++) {
+        uint32_t changed = frame[com] ^ frame_shown[com];
+        while (changed) {
+            uint8_t seg = lowest_bit(changed);
+            if (frame[com] & (1u << seg)) {
+                watch_set_pixel(com, seg);
+            } else {
+                watch_clear_pixel(com, seg);
+            }
+            changed &= changed - 1;
         }
-      }
-      return highc;
-   }
+        frame_shown[com] = frame[com];
+    }
 }
 
-static int score(int h0, int h1, int h2, int h3, int h4) {
-   int hnd[] = {h0, h1, h2, h3, h4};
-   handsort(hnd);
-
-   // find flush
-   int is_flush = 1; // assume true unless hnd has any wildcard
-
-   int lowest_wildcard = 0; // needed for run/Nkind detection
-   int second_lowest_wildcard = 0;
-   int wildcard_count = 0;
-   int i = 0;
-   for (i = 0; i < 5; i++) {
-      if (is_wild(hnd[i])) {
-        is_flush = 0;
-        lowest_wildcard = hnd[i];
-        if (i < 4) {
-         second_lowest_wildcard = hnd[i+1];
-        }
-        wildcard_count = 5 - i;
-        break;
-      }
-   }
-
-   // find 5,4,3 (of a kind), 2 (pair)
-   int run_length = 0;
-   int run_rank = 0;
-   if (lowest_wildcard) { // aka when not a flush
-    // can make at least wildcard_count of a kind with rank lowest_wildcard
-    // if there's a card lower or equal to lowest_wildcard there's a wildcard_count+1 of a kind
-    run_rank = wildcard_rank(lowest_wildcard);
-    for (i = 4 - wildcard_count; i >= 0; i--) { // high to low non-wildcards
-      if (hnd[i] <= run_rank) {
-         run_rank = hnd[i];
-         run_length = wildcard_count + 1;
-         break;
-      }
+// The backup registers the face saves to, claimed at boot in the same order every boot, and what they hold.
+// _save writes only the words that changed; 0 in save_regs[0] when Movement had too few to give.
+static uint8_t save_regs[SAVE_WORDS];
+static bird_poker_save_t saved;
+// a round restored in setup, activate leaves it on its screen
+static bool resume;
+
+// saves the balance, jackpot and hands per deal, and the open round: the dealt hand while it is up for its
+// hold, from the redraw on the redrawn hand, so a reset doesn't give the redraw another go.
+static void _save(bird_poker_face_state_t *state) {
+    if (save_regs[0] == 0) {
+        return;
     }
-    if (!run_length) { // no run found yet
-       // check if there is a card to make a better rank to replace the lowest_wildcard in the N of a kind
-       if (second_lowest_wildcard) {
-         run_rank = wildcard_rank(second_lowest_wildcard);
-         for (i = 4 - wildcard_count; i >= 0; i--) {
-            if (hnd[i] <= run_rank) {
-               run_rank = hnd[i];
-               run_length = wildcard_count;
-               break;
-            }
-         }
-       }
-       if (!run_length) {
-         run_rank = wildcard_rank(lowest_wildcard);
-         run_length = wildcard_count;
-       }
+    uint8_t round = SAVE_NONE;
+    uint8_t discards = 0;
+    uint8_t select_i = 0;
+    if (state->screen == SCREEN_DEAL) {
+        round = SAVE_HOLD;
+    } else if (state->screen == SCREEN_SELECT) {
+        round = SAVE_HOLD;
+        discards = state->discards;
+        select_i = state->select_i;
+    } else if (state->screen == SCREEN_REDRAW) {
+        round = SAVE_REDRAW;
+        discards = state->discards;
+    }
+    // a balance and jackpot too large to save still overwrite the save before, with one that doesn't restore
+    bird_poker_save_t save;
+    save_pack(state, round, discards, select_i, &save);
+    for (uint8_t i = 0; i < SAVE_WORDS; i++) {
+        if (save.words[i] != saved.words[i]) {
+            watch_store_backup_data(save.words[i], save_regs[i]);
+            saved.words[i] = save.words[i];
+        }
     }
-   }
-
-   int straight_rank = 0;
-   if (is_flush) { // straight without wildcards is always a straight flush
-      if (hnd[0] == (hnd[4] - 4)) {
-         straight_rank = hnd[4];
-      } else if (hnd[0] == CA && hnd[1] == CT) {
-         straight_rank = CAHigh;
-      }
-   } else { // straight with wildcards
-     if (hnd[0] == CA) {
-       if ((lowest_wildcard == WT && hnd[1] >= CJ) ||
-           (lowest_wildcard == WK && hnd[1] >= CT)) {
-         straight_rank = CAHigh;
-       }
-     }
-     if (!straight_rank) {
-       int highest_suit_card = hnd[4 - wildcard_count];
-       if ((highest_suit_card - hnd[0]) <= 4) { // highest and lowest non-wildcard can form a straight
-         int straight_rank_low_bound = highest_suit_card >= 5 ? highest_suit_card : 5;
-         for (i = hnd[0] + 4; i >= straight_rank_low_bound; i--) {
-            // try all possible end ranks (from high to low) and see if the available wildcards can fill the gaps
-            int wanted_rank = i;
-            int wanted_rank_low = i - 4;
-            if (lowest_wildcard < wanted_rank_low) {
-               continue;
-            }
-            int suit_i = 4 - wildcard_count;
-            int wildcard_i = 4;
-            int wildcard_i_low_bound = suit_i + 1;
-            while (wanted_rank >= wanted_rank_low) {
-               if (wanted_rank == hnd[suit_i]) {
-                  if (suit_i > 0) {
-                     suit_i--;
-                  };
-               } else if (wanted_rank <= wildcard_rank(hnd[wildcard_i])) {
-                  if (wildcard_i > wildcard_i_low_bound) {
-                     wildcard_i--;
-                  };
-               } else {
-                  break; // no suit or wildcard to be the wanted_rank
-               }
-               wanted_rank--;
-            }
-            if (wanted_rank < wanted_rank_low) {
-               straight_rank = i;
-               break;
-            }
-         }
-       }
-     }
-   }
-   int combi = 0;
-   int highc = 0;
-
-   if (is_flush && (straight_rank == CAHigh)) {
-      combi = Royal;
-   } else if (run_length == 5) {
-      combi = FiveK;
-      highc = run_rank;
-   } else if (is_flush && straight_rank) {
-      combi = StrFl;
-      highc = straight_rank;
-   } else if (run_length == 4) {
-      combi = FourK;
-      highc = run_rank;
-   } else if (straight_rank) {
-      combi = Strgt;
-      highc = straight_rank;
-   } else if (is_flush) {
-      combi = Flush;
-      highc = highcard(hnd, 0);
-   } else if (run_length == 3) {
-      combi = Trips;
-      highc = run_rank;
-   } else if (run_length == 2) {
-      combi = OnePr;
-      highc = run_rank;
-   } else {
-      combi = HighC;
-      highc = highcard(hnd, wildcard_count);
-   }
-   return ((combi << 4) | highc) ;
-}
-
-
-// returns a random integer r with 0 <= r < max
-static uint8_t generate_random_number(uint8_t num_values) {
-    // Emulator: use rand. Hardware: use arc4random.
-#if __EMSCRIPTEN__
-    return rand() % num_values;
-#else
-    return arc4random_uniform(num_values);
-#endif
 }
 
 void bird_poker_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
@@ -279,12 +114,33 @@ void bird_poker_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
          bird_poker_face_state_t *state = (bird_poker_face_state_t *)*context_ptr;
          state->jackpot = PAYOUTS_PRIZES[Royal];
-    }
+         state->hands = 1;
+         // seed the card stream once, the seed and position replay every deal
 #if __EMSCRIPTEN__
-    // simulator only: seed the randon number generator
-    time_t t;
-    srand((unsigned)time(&t));
+         time_t t;
+         bird_poker_rng_seed(&state->rng, (uint64_t)time(&t), 0);
+#else
+         bird_poker_rng_seed(&state->rng, ((uint64_t)arc4random() << 32) | arc4random(), 0);
 #endif
+         for (uint8_t i = 0; i < SAVE_WORDS; i++) {
+             save_regs[i] = movement_claim_backup_register();
+             if (save_regs[i] == 0) {
+                 save_regs[0] = 0;
+                 break;
+             }
+             saved.words[i] = watch_get_backup_data(save_regs[i]);
+         }
+         // the registers outlive a reset: an open round goes back to its hold, or to its redraw
+         uint8_t round;
+         uint8_t discards;
+         uint8_t select_i;
+         if (save_regs[0] != 0 && save_unpack(&saved, state, &round, &discards, &select_i) && round != SAVE_NONE) {
+             state->screen = round == SAVE_REDRAW ? SCREEN_REDRAW : SCREEN_SELECT;
+             state->discards = discards;
+             state->select_i = select_i;
+             resume = true;
+         }
+    }
 }
 
 void bird_poker_face_activate(movement_settings_t *settings, void *context) {
@@ -292,307 +148,98 @@ void bird_poker_face_activate(movement_settings_t *settings, void *context) {
 
     // Handle any tasks related to your watch face coming on screen.
     //watch_set_colon();
+    // the previous face left its own segments, start from a blank LCD
+    watch_clear_display();
+    frame_shown[0] = 0;
+    frame_shown[1] = 0;
+    frame_shown[2] = 0;
     bird_poker_face_state_t *state = (bird_poker_face_state_t *)context;
-    state->screen = SCREEN_WELCOME;
+    // an open round carries on where the player left it, or where setup restored it to: it is paid for
+    if (!resume && state->screen != SCREEN_DEAL && state->screen != SCREEN_SELECT && state->screen != SCREEN_REDRAW) {
+        state->screen = SCREEN_WELCOME;
+    }
+}
+
+// positions that show cards, t is WT there and the t of St elsewhere
+#define CARD_POSITIONS ((1 << 3) | (0x1F << 5))
+
+// draws the segments glyph on position, one masked write per COM. Joined segments take the last segment,
+// as watch_display_character_lp_seconds writes them.
+static void setGlyph(uint8_t position, uint8_t glyph) {
+    uint64_t segmap = Segment_Map[position];
+    uint32_t mask[3] = {0, 0, 0};
+    uint32_t on[3] = {0, 0, 0};
+    for (uint8_t i = 0; i < 8; i++) {
+        uint8_t com = (segmap & 0xFF) >> 6;
+        if (com <= 2) {
+            uint32_t bit = 1u << (segmap & 0x3F);
+            mask[com] |= bit;
+            on[com] = (on[com] & ~bit) | (glyph & 1 ? bit : 0);
+        }
+        segmap >>= 8;
+        glyph >>= 1;
+    }
+    frame[0] = (frame[0] & ~mask[0]) | on[0];
+    frame[1] = (frame[1] & ~mask[1]) | on[1];
+    frame[2] = (frame[2] & ~mask[2]) | on[2];
 }
 
 static void setChar(uint8_t position, char chr) {
-    switch (chr) {
-        case '7': {
-            switch (position) {
-                case 3: {
-                    watch_set_pixel(2,7);
-                    watch_set_pixel(1,8);
-                    return;
-                }
-                case 5: {
-                    watch_set_pixel(1,21);
-                    watch_set_pixel(1,20);
-                    return;
-                }
-                case 6: {
-                    watch_set_pixel(0,23);
-                    watch_set_pixel(1,23);
-                    return;
-                }
-                case 7: {
-                    watch_set_pixel(0,1);
-                    watch_set_pixel(1,1);
-                    return;
-                }
-                case 8: {
-                    watch_set_pixel(0,4);
-                    watch_set_pixel(1,3);
-                    return;
-                }
-                case 9: {
-                    watch_set_pixel(1,6);
-                    watch_set_pixel(1,5);
-                    return;
-                }
-            }
-            break;
-        }
-        case 'T': {
-            switch (position) {
-                case 3: {
-                    watch_set_pixel(0,7);
-                    watch_set_pixel(2,7);
-                    watch_set_pixel(2,6);
-                    watch_set_pixel(2,8);
-                    watch_set_pixel(1,8);
-                    return;
-                }
-                case 5: {
-                    watch_set_pixel(2,20);
-                    watch_set_pixel(1,21);
-                    watch_set_pixel(0,21);
-                    watch_set_pixel(0,20);
-                    watch_set_pixel(1,20);
-                    return;
-                }
-                case 6: {
-                    watch_set_pixel(0,22);
-                    watch_set_pixel(0,23);
-                    watch_set_pixel(0,22);
-                    watch_set_pixel(1,22);
-                    watch_set_pixel(1,23);
-                    return;
-                }
-                case 7: {
-                    watch_set_pixel(2,1);
-                    watch_set_pixel(0,1);
-                    watch_set_pixel(0,0);
-                    watch_set_pixel(1,0);
-                    watch_set_pixel(1,1);
-                    return;
-                }
-                case 8: {
-                    watch_set_pixel(2,2);
-                    watch_set_pixel(0,4);
-                    watch_set_pixel(0,3);
-                    watch_set_pixel(0,2);
-                    watch_set_pixel(1,3);
-                    return;
-                }
-                case 9: {
-                    watch_set_pixel(2,4);
-                    watch_set_pixel(1,6);
-                    watch_set_pixel(0,6);
-                    watch_set_pixel(0,5);
-                    watch_set_pixel(1,5);
-                    return;
-                }
-            }
-            break;
-        }
-        case 'J': {
-            chr = ']';
-            break;
-        }
-        case 'Q': {
-            chr = 'u';
-            break;
-        }
-        case 'K': {
-            chr = '+';
-            break;
-        }
-        case 'f': { // W4
-            switch (position) {
-                case 3: {
-                    watch_set_pixel(1,7);
-                    watch_set_pixel(2,8);
-                    watch_set_pixel(0,8);
-                    watch_set_pixel(1,8);
-                    return;
-                }
-                case 5: {
-                    watch_set_pixel(2,21);
-                    watch_set_pixel(0,20);
-                    watch_set_pixel(1,17);
-                    watch_set_pixel(1,20);
-                    return;
-                }
-                case 6: {
-                    watch_set_pixel(2,23);
-                    watch_set_pixel(1,22);
-                    watch_set_pixel(2,22);
-                    watch_set_pixel(1,23);
-                    return;
-                }
-                case 7: {
-                    watch_set_pixel(2,10);
-                    watch_set_pixel(1,0);
-                    watch_set_pixel(2,0);
-                    watch_set_pixel(1,1);
-                    return;
-                }
-                case 8: {
-                    watch_set_pixel(2,3);
-                    watch_set_pixel(0,2);
-                    watch_set_pixel(1,2);
-                    watch_set_pixel(1,3);
-                    return;
-                }
-                case 9: {
-                    watch_set_pixel(2,5);
-                    watch_set_pixel(0,5);
-                    watch_set_pixel(1,4);
-                    watch_set_pixel(1,5);
-                    return;
-                }
-            }
-            break;
-        }
-        case 't': { //WT
-            switch (position) {
-                case 3: {
-                    watch_set_pixel(0,7);
-                    watch_set_pixel(1,7);
-                    watch_set_pixel(2,6);
-                    watch_set_pixel(0,8);
-                    watch_set_pixel(1,8);
-                    return;
-                }
-                case 5: {
-                    watch_set_pixel(2,20);
-                    watch_set_pixel(2,21);
-                    watch_set_pixel(0,21);
-                    watch_set_pixel(1,17);
-                    watch_set_pixel(1,20);
-                    return;
-                }
-                case 6: {
-                    watch_set_pixel(0,22);
-                    watch_set_pixel(2,23);
-                    watch_set_pixel(0,22);
-                    watch_set_pixel(2,22);
-                    watch_set_pixel(1,23);
-                    return;
-                }
-                case 7: {
-                    watch_set_pixel(2,1);
-                    watch_set_pixel(2,10);
-                    watch_set_pixel(0,0);
-                    watch_set_pixel(2,0);
-                    watch_set_pixel(1,1);
-                    return;
-                }
-                case 8: {
-                    watch_set_pixel(2,2);
-                    watch_set_pixel(2,3);
-                    watch_set_pixel(0,3);
-                    watch_set_pixel(1,2);
-                    watch_set_pixel(1,3);
-                    return;
-                }
-                case 9: {
-                    watch_set_pixel(2,4);
-                    watch_set_pixel(2,5);
-                    watch_set_pixel(0,6);
-                    watch_set_pixel(1,4);
-                    watch_set_pixel(1,5);
-                    return;
-                }
-            }
-            break;
-        }
-        case 'k': { // WK
-            switch (position) {
-                case 3: {
-                    watch_set_pixel(1,7);
-                    watch_set_pixel(2,7);
-                    watch_set_pixel(1,8);
-                    return;
-                }
-                case 5: {
-                    watch_set_pixel(2,21);
-                    watch_set_pixel(1,21);
-                    watch_set_pixel(1,20);
-                    return;
-                }
-                case 6: {
-                    watch_set_pixel(2,23);
-                    watch_set_pixel(0,23);
-                    watch_set_pixel(1,23);
-                    return;
-                }
-                case 7: {
-                    watch_set_pixel(2,10);
-                    watch_set_pixel(0,1);
-                    watch_set_pixel(1,1);
-                    return;
-                }
-                case 8: {
-                    watch_set_pixel(2,3);
-                    watch_set_pixel(0,4);
-                    watch_set_pixel(1,3);
-                    return;
-                }
-                case 9: {
-                    watch_set_pixel(2,5);
-                    watch_set_pixel(1,6);
-                    watch_set_pixel(1,5);
-                    return;
-                }
-            }
-            break;
-        }
-        case '_': {
-            switch (position) {
-                case 5: {
-                    watch_set_pixel(2,20);
-                    watch_set_pixel(0,21);
-                    return;
-                }
-                case 6: {
-                    watch_set_pixel(0,22);
-                    return;
-                }
-                case 7: {
-                    watch_set_pixel(2,1);
-                    watch_set_pixel(0,0);
-                    return;
-                }
-                case 8: {
-                    watch_set_pixel(2,2);
-                    watch_set_pixel(0,3);
-                    return;
-                }
-                case 9: {
-                    watch_set_pixel(2,4);
-                    watch_set_pixel(0,6);
-                    return;
-                }
-            }
-            break;
-        }
-        case '^': { // t in SUIt
-            chr = 't';
-        }
+    if (chr == 't' && !(CARD_POSITIONS & (1 << position))) {
+        chr = '^';
     }
-     
-    // this is watch_display_character, without the builtin character replacements
-    watch_display_character_lp_seconds(chr, position);
-    
+    setGlyph(position, GLYPHS[(uint8_t)chr - 0x20]);
 }
 
-static void setNum(uint64_t num, int8_t display_num_length, uint8_t tick_count) {
-    char buffer[22];
-    sprintf(buffer," %20lld",num);
-    
-    if (num < 1000000) {
-        watch_display_string(buffer+15, 4);
+// digits of numbers take Character_Set as watch_display_string draws them, 7 is lowercase on 4 and 6 only
+static void setDigit(uint8_t position, char chr) {
+    if (chr == '7' && (position == 4 || position == 6)) {
+        chr = '&';
+    }
+    setGlyph(position, Character_Set[(uint8_t)chr - 0x20]);
+}
+
+// watch_display_string into frame
+static void setString(const char *string, uint8_t position) {
+    for (; *string != 0 && position < Num_Chars; string++, position++) {
+        setChar(position, *string);
+    }
+}
+
+// num_chars gets a space and the decimal digits of num, returns the number of digits
+static uint8_t formatNum(uint64_t num, char num_chars[NUM_CHARS]) {
+    char digits[NUM_CHARS - 1];
+    uint8_t length = 0;
+    do {
+        digits[length++] = '0' + (num % 10);
+        num /= 10;
+    } while (num != 0);
+    num_chars[0] = ' ';
+    for (uint8_t i = 0; i < length; i++) {
+        num_chars[1 + i] = digits[length - 1 - i];
+    }
+    return length;
+}
+
+// Up to 6 digits right aligned on positions 4 to 9. Longer numbers scroll: frame tick_count shows
+// num_chars from tick_count on, a space and the first 5 digits at 0 to the last 6 digits at length - 5.
+static void setNumChars(const char *num_chars, uint8_t length, uint8_t tick_count) {
+    if (length <= 6) {
+        for (uint8_t i = 0; i < 6; i++) {
+            setDigit(4 + i, i < 6 - length ? ' ' : num_chars[1 + i - (6 - length)]);
+        }
     } else {
-        if (tick_count == 0) {
-            watch_display_string(buffer + (21 - 6 - display_num_length), 5);
-        } else {
-            watch_display_string(buffer + (21 - 7 - display_num_length) + tick_count, 4);
+        for (uint8_t i = 0; i < 6; i++) {
+            setDigit(4 + i, num_chars[tick_count + i]);
         }
     }
 }
 
+static void setNum(uint64_t num) {
+    char num_chars[NUM_CHARS];
+    setNumChars(num_chars, formatNum(num, num_chars), 0);
+}
+
 static void handleEvent(bird_poker_face_state_t *state, uint8_t ev);
 
 static void setScreen(bird_poker_face_state_t *state, uint8_t screen) {
@@ -604,7 +251,8 @@ static void handleEventTitleNumber(bird_poker_face_state_t *state, uint8_t ev, c
     switch (ev) {
         case EV_INIT: {
             state->tick_count = 0;
-            state->display_num_length = (((int) floor(log(num)/log(10))) + 1) - 6;
+            state->num_length = formatNum(num, state->num_chars);
+            state->display_num_length = state->num_length - 6;
             if (0 < state->display_num_length) {
                 state->tick_freq = 2;
                 movement_request_tick_frequency(2);
@@ -627,11 +275,11 @@ static void handleEventTitleNumber(bird_poker_face_state_t *state, uint8_t ev, c
             setScreen(state, next_screen);
             return;
     }
-    watch_clear_display();
+    clearFrame();
     setChar(0, t1);
     setChar(1, t2);
     setChar(3, t3);
-    setNum(num, state->display_num_length, (int)(state->tick_count / 2));
+    setNumChars(state->num_chars, state->num_length, state->tick_count / 2);
 }
 
 static void handleEvent_WELCOME(bird_poker_face_state_t *state, uint8_t ev) {
@@ -639,8 +287,8 @@ static void handleEvent_WELCOME(bird_poker_face_state_t *state, uint8_t ev) {
         case EV_INIT:
             state->tick_freq = 1;
             movement_request_tick_frequency(1);
-            watch_clear_display();
-            watch_display_string(" birdP", 4);
+            clearFrame();
+            setString(" birdP", 4);
             if (state->balance == 0) {
                 state->balance = 20;
             }
@@ -649,11 +297,23 @@ static void handleEvent_WELCOME(bird_poker_face_state_t *state, uint8_t ev) {
             setScreen(state, SCREEN_DEAL);
             break;
         case EV_BOTTOM_RIGHT:
-            setScreen(state, SCREEN_WELCOME_BALANCE);
+            setScreen(state, SCREEN_WELCOME_HANDS);
             break;
     }
 }
 
+// a long press steps through 1, 3, 10 and MAX_HANDS hands per deal
+static void handleEvent_WELCOME_HANDS(bird_poker_face_state_t *state, uint8_t ev) {
+    switch (ev) {
+        case EV_BOTTOM_RIGHT_LONG: {
+            state->hands = state->hands == 1 ? 3 : state->hands == 3 ? 10 : state->hands == 10 ? MAX_HANDS : 1;
+            setScreen(state, SCREEN_WELCOME_HANDS);
+            return;
+        }
+    }
+    handleEventTitleNumber(state, ev, 'H', 'n', 'd', state->hands, SCREEN_WELCOME_BALANCE);
+}
+
 static void handleEvent_WELCOME_BALANCE(bird_poker_face_state_t *state, uint8_t ev) {
     handleEventTitleNumber(state, ev, 'b', 'A', 'L', state->balance, SCREEN_WELCOME_COMBO_ROYAL);
 }
@@ -683,13 +343,13 @@ static void handleEvent_WELCOME_COMBOS(bird_poker_face_state_t *state, uint8_t e
         case EV_TICK:
             return;
     }
-    watch_clear_display();
+    clearFrame();
     const char *combo_name = PAYOUTS_NAMES[state->tick_count];
     setChar(0, combo_name[0]);
     setChar(1, combo_name[1]);
     
     uint8_t prize = PAYOUTS_PRIZES[state->tick_count];
-    setNum(prize,0,0);
+    setNum(prize);
     
 }
 
@@ -713,7 +373,7 @@ static void handleEvent_WELCOME_CARDS(bird_poker_face_state_t *state, uint8_t ev
         case EV_TICK:
             return;
     }
-    watch_clear_display();
+    clearFrame();
     if (state->tick_count <= 2) {
         setChar(0, 'S');
         setChar(1, 'U');
@@ -752,7 +412,8 @@ static void handleEvent_WELCOME_CARDS(bird_poker_face_state_t *state, uint8_t ev
 
 static void handleEvent_DEAL_AND_REDRAW(bird_poker_face_state_t *state, uint8_t ev, uint8_t next_screen) {
     switch (ev) {
-        case EV_INIT: {
+        case EV_INIT:
+        case EV_RESUME: {
             state->tick_count = 0;
             state->tick_freq = 4;
             movement_request_tick_frequency(4);
@@ -767,7 +428,7 @@ static void handleEvent_DEAL_AND_REDRAW(bird_poker_face_state_t *state, uint8_t
         setScreen(state, next_screen);
         return;
     } else {
-        watch_clear_display();
+        clearFrame();
         for (int8_t i = 0; i < 5; i++) {
             char c = 0;
             if (state->discards & (1 << i)) {
@@ -791,28 +452,62 @@ static void handleEvent_DEAL_AND_REDRAW(bird_poker_face_state_t *state, uint8_t
     }
 }
 
+// The round for the hand history, with BIRD_POKER_LOG: the deal, the hold and redraw, and at settle the rest.
+#ifdef BIRD_POKER_LOG
+static bird_poker_round_t log_round;
+
+static void _logDeal(bird_poker_face_state_t *state, uint32_t dealt) {
+    log_round.deal = hand_rank(dealt);
+    log_round.hold = 0x1F;
+    log_round.redraw = 0;
+    log_round.hands = state->deal_hands;
+}
+
+static void _logRedraw(bird_poker_face_state_t *state) {
+    log_round.hold = hold_bits(state->hands_dealt, state->hands_held);
+    log_round.redraw = log_redraw_rank(state->hands_dealt, hand_mask(state->hand) & ~state->hands_held);
+}
+
+static void _logSettle(bird_poker_face_state_t *state) {
+    log_round.score = state->settle_score;
+    log_round.prize = state->settle_prize;
+    log_round.balance = state->balance;
+    log_round.jackpot = state->jackpot;
+    bird_poker_log_round(&log_round);
+}
+#else
+#define _logDeal(state, dealt)
+#define _logRedraw(state)
+#define _logSettle(state)
+#endif
+
 static void _deal(bird_poker_face_state_t *state) {
+    uint8_t count = popcount16(state->discards & 0x1F);
+    uint8_t cards[5];
+    deal_cards(&state->rng, &state->dealt, count, cards);
+    uint8_t next = 0;
     for (int8_t i = 0; i < 5; i++) {
         if (state->discards & (1 << i)) {
-            int8_t dealt_count = __builtin_popcount(state->dealt);
-            // idx 1 - 17 inc
-            int32_t idx = generate_random_number(17 - dealt_count) + 1;
-            int32_t c = idx;
-            for (int32_t j = 1; j <= idx; j++) {
-                if (state->dealt & (1 << j)) {
-                    c++;
-                }
-            }
-            while (state->dealt & (1 << c)) {
-                c++;
-                if (c > 18) { break; }
-            }
-            state->dealt |= 1 << c;
-            state->hand[i] = c;
+            state->hand[i] = cards[next++];
         }
     }
 }
 
+// The extra hands of a multi hand deal play HANDS_PER_TICK at a time on the redraw ticks, the rest at settle.
+#define HANDS_PER_TICK 25
+
+static void _playHands(bird_poker_face_state_t *state, uint8_t batch) {
+    if (state->hands_played + 1 >= state->deal_hands) {
+        return;
+    }
+    uint8_t left = state->deal_hands - 1 - state->hands_played;
+    if (batch > left) {
+        batch = left;
+    }
+    play_hands(&state->rng, state->hands_dealt, state->hands_held, batch, state->settle_counts);
+    state->hands_played += batch;
+}
+
 static void handleEvent_DEAL(bird_poker_face_state_t *state, uint8_t ev){
     switch (ev) {
         case EV_INIT: {
@@ -823,11 +518,15 @@ static void handleEvent_DEAL(bird_poker_face_state_t *state, uint8_t ev){
             
             state->settle_score = 0;
             state->settle_prize = 0;
+            state->deal_hands = state->balance < state->hands ? state->balance : state->hands;
+            state->hands_played = 0;
+            memset(state->settle_counts, 0, sizeof(state->settle_counts));
             state->discards = 0xFF; //all discarded to animate 5 cards
             state->dealt = 0;
             _deal(state);
-            state->balance--;
-            state->jackpot++;
+            state->balance -= state->deal_hands;
+            state->jackpot += state->deal_hands;
+            _logDeal(state, state->dealt);
             break;
         }
         case EV_TOP_LEFT: {
@@ -835,8 +534,8 @@ static void handleEvent_DEAL(bird_poker_face_state_t *state, uint8_t ev){
             return;
         }
         case EV_BOTTOM_RIGHT: {
-            setNum(state->dealt,0,0);
-            //setNum(1 << 1, 0,0);
+            setNum(state->dealt);
+            //setNum(1 << 1);
             return;
         }
     }
@@ -847,12 +546,19 @@ static void handleEvent_DEAL(bird_poker_face_state_t *state, uint8_t ev){
 
 static void handleEvent_SELECT(bird_poker_face_state_t *state, uint8_t ev) {
     switch (ev) {
-        case EV_INIT: {
+        case EV_INIT:
             state->discards = 0;
-            state->tick_count = 0;
             state->select_i = 0;
+            // fall through
+        case EV_RESUME: {
+            // a round restored after a reset comes back to its hold
+            state->tick_count = 0;
             state->tick_freq = 4;
             movement_request_tick_frequency(4);
+            state->hands_played = 0;
+            state->settle_score = 0;
+            state->settle_prize = 0;
+            memset(state->settle_counts, 0, sizeof(state->settle_counts));
             break;
         }
         case EV_TICK: {
@@ -870,8 +576,28 @@ static void handleEvent_SELECT(bird_poker_face_state_t *state, uint8_t ev) {
             state->tick_count = 0;
             break;
         }
+        case EV_BOTTOM_RIGHT_LONG: {
+            // preselect the discards of the best hold for the jackpot, the cursor goes to - to redraw them
+            uint32_t held = hold_lookup_jackpot_cards(state->dealt, state->jackpot);
+            state->discards = 0;
+            for (uint8_t i = 0; i < 5; i++) {
+                if (!(held & (1 << state->hand[i]))) {
+                    state->discards |= 1 << i;
+                }
+            }
+            state->select_i = 0;
+            state->tick_count = 0;
+            break;
+        }
         case EV_TOP_LEFT: {
             if (state->select_i == 0) {
+                state->hands_dealt = state->dealt;
+                state->hands_held = 0;
+                for (uint8_t i = 0; i < 5; i++) {
+                    if (!(state->discards & (1 << i))) {
+                        state->hands_held |= 1 << state->hand[i];
+                    }
+                }
                 if (state->discards > 0) {
                     setScreen(state, SCREEN_REDRAW);
                     return;
@@ -890,7 +616,7 @@ static void handleEvent_SELECT(bird_poker_face_state_t *state, uint8_t ev) {
             break;
         }
     }
-    watch_clear_display();
+    clearFrame();
     uint8_t c = ' ';
     if (state->select_i == 0) {
         if (state->tick_count != 1) {
@@ -931,6 +657,15 @@ static void handleEvent_REDRAW(bird_poker_face_state_t *state, uint8_t ev) {
     switch (ev) {
         case EV_INIT: {
             _deal(state);
+            _logRedraw(state);
+            break;
+        }
+        case EV_RESUME: {
+            // the animation again, over the cards drawn before
+            break;
+        }
+        case EV_TICK: {
+            _playHands(state, HANDS_PER_TICK);
             break;
         }
     }
@@ -945,17 +680,21 @@ static void handleEvent_SETTLE(bird_poker_face_state_t *state, uint8_t ev) {
             movement_request_tick_frequency(1);
 
             if (state->settle_score == 0) {
-                state->settle_score = score(state->hand[0],state->hand[1],state->hand[2],state->hand[3],state->hand[4]);
-                int combi = state->settle_score >> 4;
-                state->settle_prize = PAYOUTS_PRIZES[combi];
-                if (combi == Royal) {
-                    state->settle_prize = state->jackpot;
-                    state->balance += state->settle_prize;
+                _playHands(state, MAX_HANDS);
+                state->settle_score = score_lookup(hand_mask(state->hand));
+                state->settle_counts[state->settle_score >> 4]++;
+                state->settle_prize = 0;
+                for (uint8_t combi = HighC; combi < Royal; combi++) {
+                    state->settle_prize += state->settle_counts[combi] * PAYOUTS_PRIZES[combi];
+                }
+                // the first Royal takes the jackpot, more Royals of the deal the jackpot it resets to
+                uint8_t royals = state->settle_counts[Royal];
+                if (royals) {
+                    state->settle_prize += state->jackpot + (royals - 1) * PAYOUTS_PRIZES[Royal];
                     state->jackpot = PAYOUTS_PRIZES[Royal];
-                } else {
-                    state->settle_prize = PAYOUTS_PRIZES[combi];
-                    state->balance += state->settle_prize;
                 }
+                state->balance += state->settle_prize;
+                _logSettle(state);
             }
             break;
         }
@@ -974,7 +713,7 @@ static void handleEvent_SETTLE(bird_poker_face_state_t *state, uint8_t ev) {
 
     const char* PAYOUT_NAME = PAYOUTS_NAMES[combi];
 
-    watch_clear_display();
+    clearFrame();
     setChar(0, PAYOUT_NAME[0]);
     setChar(1, PAYOUT_NAME[1]);
 
@@ -985,11 +724,45 @@ static void handleEvent_SETTLE(bird_poker_face_state_t *state, uint8_t ev) {
     for (int8_t i = 0; i < 5; i++) {
         setChar(5 + i, CARD_CHARS[state->hand[i]]);
     }
-    //setNum(state->settle_score,0,0);
+    //setNum(state->settle_score);
 }
 
 static void handleEvent_SETTLE_PRIZE(bird_poker_face_state_t *state, uint8_t ev) {
-    handleEventTitleNumber(state, ev, 'W', '1', 'n', state->settle_prize, SCREEN_SETTLE_BALANCE);
+    handleEventTitleNumber(state, ev, 'W', '1', 'n', state->settle_prize,
+                           state->deal_hands > 1 ? SCREEN_SETTLE_COMBOS : SCREEN_SETTLE_BALANCE);
+}
+
+// the hands by combi of a multi hand deal, from Royal down, combis without hands left out
+static void handleEvent_SETTLE_COMBOS(bird_poker_face_state_t *state, uint8_t ev) {
+    switch (ev) {
+        case EV_INIT:
+            state->tick_freq = 1;
+            movement_request_tick_frequency(1);
+            state->tick_count = Royal;
+            while (state->settle_counts[state->tick_count] == 0) {
+                state->tick_count--;
+            }
+            break;
+        case EV_TOP_LEFT:
+            setScreen(state, SCREEN_DEAL);
+            return;
+        case EV_BOTTOM_RIGHT:
+            do {
+                state->tick_count--;
+            } while (state->tick_count > 0 && state->settle_counts[state->tick_count] == 0);
+            if (state->tick_count == 0) {
+                setScreen(state, SCREEN_SETTLE_BALANCE);
+                return;
+            }
+            break;
+        case EV_TICK:
+            return;
+    }
+    clearFrame();
+    const char *combo_name = PAYOUTS_NAMES[state->tick_count];
+    setChar(0, combo_name[0]);
+    setChar(1, combo_name[1]);
+    setNum(state->settle_counts[state->tick_count]);
 }
 
 static void handleEvent_SETTLE_BALANCE(bird_poker_face_state_t *state, uint8_t ev) {
@@ -1024,7 +797,7 @@ static void handleEvent_BUST(bird_poker_face_state_t *state, uint8_t ev) {
         }
     }
 
-    watch_clear_display();
+    clearFrame();
     if (state->tick_count == 0) {
         setChar(5, 'b');
         setChar(6, 'Q'); // u
@@ -1055,6 +828,10 @@ static void handleEvent(bird_poker_face_state_t *state, uint8_t ev) {
             handleEvent_WELCOME_CARDS(state, ev);
             break;
         }
+        case SCREEN_WELCOME_HANDS: {
+            handleEvent_WELCOME_HANDS(state, ev);
+            break;
+        }
         case SCREEN_DEAL: {
             handleEvent_DEAL(state, ev);
             break;
@@ -1083,6 +860,10 @@ static void handleEvent(bird_poker_face_state_t *state, uint8_t ev) {
             handleEvent_SETTLE_JACKPOT(state, ev);
             break;
         }
+        case SCREEN_SETTLE_COMBOS: {
+            handleEvent_SETTLE_COMBOS(state, ev);
+            break;
+        }
         case SCREEN_BUST: {
             handleEvent_BUST(state, ev);
             break;
@@ -1098,8 +879,19 @@ bool bird_poker_face_loop(movement_event_t event, movement_settings_t *settings,
         case EVENT_ACTIVATE:
             // Show your initial UI here.
             //_bird_poker_face_update_display(settings);
-            setScreen(state, SCREEN_WELCOME);
-
+            if (state->screen == SCREEN_WELCOME) {
+                setScreen(state, SCREEN_WELCOME);
+            } else {
+                if (resume) {
+                    // the round restored in setup, for the hand history
+                    _logDeal(state, state->screen == SCREEN_REDRAW ? state->hands_dealt : state->dealt);
+                    if (state->screen == SCREEN_REDRAW) {
+                        _logRedraw(state);
+                    }
+                }
+                handleEvent(state, EV_RESUME);
+            }
+            resume = false;
             break;
         case EVENT_TICK:
             // If needed, update your display here.
@@ -1119,6 +911,9 @@ bool bird_poker_face_loop(movement_event_t event, movement_settings_t *settings,
             // Just in case you have need for another button.
             handleEvent(state, EV_BOTTOM_RIGHT);
             break;
+        case EVENT_ALARM_LONG_PRESS:
+            handleEvent(state, EV_BOTTOM_RIGHT_LONG);
+            break;
         case EVENT_TIMEOUT:
             // Your watch face will receive this event after a period of inactivity. If it makes sense to resign,
             // you may uncomment this line to move back to the first watch face in the list:
@@ -1139,6 +934,8 @@ bool bird_poker_face_loop(movement_event_t event, movement_settings_t *settings,
             // You can override any of these behaviors by adding a case for these events to this switch statement.
             return movement_default_loop_handler(event, settings);
     }
+    commitFrame();
+    _save(state);
 
     // return true if the watch can enter standby mode. Generally speaking, you should always return true.
     // Exceptions:
@@ -2,6 +2,9 @@
 #define bird_poker_FACE_H_
 
 #include "movement.h"
+#include "bird_poker_rng.h"
+
+#define NUM_CHARS 21 // a space and the up to 20 digits of a uint64_t
 
 typedef struct {
     // Anything you need to keep track of, put it here!
@@ -10,6 +13,8 @@ typedef struct {
     uint64_t jackpot;
     uint8_t tick_count;
     int8_t display_num_length;
+    uint8_t num_length;
+    char num_chars[NUM_CHARS];
     uint8_t tick_freq;
     uint8_t discards;
     uint32_t dealt;
@@ -17,6 +22,13 @@ typedef struct {
     uint8_t select_i;
     uint8_t settle_score;
     uint64_t settle_prize;
+    uint8_t hands; // hands per deal: 1, 3, 10 or MAX_HANDS
+    uint8_t deal_hands; // hands of this deal, fewer when the balance is short
+    uint8_t hands_played; // extra hands played of this deal
+    uint32_t hands_dealt; // the 5 dealt cards, the extra hands redraw from the others
+    uint32_t hands_held;
+    uint8_t settle_counts[10]; // hands of this deal by combi
+    bird_poker_rng_t rng;
 } bird_poker_face_state_t;
 
 void bird_poker_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
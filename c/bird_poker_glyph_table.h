@@ -0,0 +1,28 @@
+#ifndef bird_poker_GLYPH_TABLE_H_
+#define bird_poker_GLYPH_TABLE_H_
+
+// Generated by tools/gen_glyph_table.c from picolisp/lcd.l, do not edit.
+// GLYPHS[c - 0x20] are the segments of character c as in Character_Set: bit 0..6 segments A..G, bit 7 the
+// inner bars of position 0. W4, W7, WT, WK of lcd.l are f, r, t, k (CARD_CHARS), the t of lcd.l is ^.
+// Characters lcd.l lacks are the Character_Set ones.
+
+#include <stdint.h>
+
+#define GLYPH_COUNT 96
+
+static const uint8_t GLYPHS[GLYPH_COUNT] = {
+    0x00, 0x60, 0x22, 0xff, 0x2d, 0x00, 0x44, 0x20, //  !"#$%&'
+    0x39, 0x0f, 0xc0, 0x70, 0x04, 0x40, 0x40, 0x12, // ()*+,-./
+    0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x44, // 01234567
+    0x7f, 0x6f, 0x00, 0x00, 0x58, 0x48, 0x4c, 0x53, // 89:;<=>?
+    0xff, 0x77, 0x7f, 0x39, 0x3f, 0x79, 0x71, 0x3d, // @ABCDEFG
+    0x76, 0x30, 0x0f, 0x70, 0x38, 0xb7, 0x37, 0x3f, // HIJKLMNO
+    0x73, 0x62, 0xf3, 0x6d, 0x5d, 0x3e, 0x3e, 0xbe, // PQRSTUVW
+    0x7e, 0x6e, 0x1b, 0x39, 0x24, 0x0f, 0x78, 0x09, // XYZ[\]^_
+    0x02, 0x5f, 0x7c, 0x58, 0x5e, 0x7b, 0x72, 0x6f, // `abcdefg
+    0x74, 0x10, 0x42, 0x46, 0x30, 0xb7, 0x54, 0x5c, // hijklmno
+    0x73, 0x67, 0x50, 0x6d, 0x6b, 0x62, 0x62, 0xbe, // pqrstuvw
+    0x7e, 0x6e, 0x1b, 0x16, 0x36, 0x34, 0x41, 0x00, // xyz{|}~ 
+};
+
+#endif // bird_poker_GLYPH_TABLE_H_
@@ -0,0 +1,24 @@
+#ifndef bird_poker_HANDS_H_
+#define bird_poker_HANDS_H_
+
+// Multi hand play, shared by the watch face and the host tools in tools/. The held cards of the dealt hand go
+// into every extra hand, each of them redraws the other cards from the cards not dealt on its own, as if from
+// its own copy of the deck.
+
+#include <stdint.h>
+#include "bird_poker_deal.h"
+#include "bird_poker_score_table.h"
+
+#define MAX_HANDS 100
+
+// plays hands extra hands of the 5 dealt cards, adds the combi of each to combi_counts
+static inline void play_hands(bird_poker_rng_t *rng, uint32_t dealt, uint32_t held, uint8_t hands, uint8_t combi_counts[10]) {
+    deal_t deal;
+    deal_init(&deal, dealt, 5 - (count_bits(held).sums >> 24));
+    uint8_t cards[5];
+    for (uint8_t i = 0; i < hands; i++) {
+        combi_counts[score_lookup(held | deal_draw(&deal, rng, cards)) >> 4]++;
+    }
+}
+
+#endif // bird_poker_HANDS_H_
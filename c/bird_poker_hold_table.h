@@ -0,0 +1,885 @@
+#ifndef bird_poker_HOLD_TABLE_H_
+#define bird_poker_HOLD_TABLE_H_
+
+// Generated by tools/gen_hold_table.c, do not edit.
+// The hold with the best expected prize of every 5 card hand, with Royal paying the starting jackpot
+// PAYOUTS_PRIZES[Royal]. HOLD_BITS bits per hand_rank(mask), little endian, bit i holds the i-th lowest card
+// of the hand. Check with tools/gen_hold_table -c
+
+#include "bird_poker_score.h"
+
+#define HOLD_BITS 5
+#define HOLD_BREAK_COUNT 4308
+#define HOLD_BREAK_RANK_BITS 6
+
+static const uint8_t HOLD_TABLE[(HAND_COUNT * HOLD_BITS + 7) / 8] = {
+    0xdf, 0x7b, 0xef, 0xff, 0x7b, 0xef, 0xbd, 0xff, 0xbd, 0xe7, 0xde, 0x7b, 0xff, 0xdf, 0x7b, 0xef,
+    0xfd, 0xff, 0xdf, 0xff, 0xcf, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0x7f, 0xef, 0x3d, 0xe7, 0xdc, 0x7b,
+    0xef, 0xbd, 0xff, 0xef, 0xbd, 0xf7, 0xfe, 0xff, 0xef, 0xff, 0xe7, 0xde, 0xfb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe,
+    0xff, 0xff, 0x7f, 0xef, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0xde, 0x7b, 0xef, 0xff, 0x7b,
+    0xef, 0xbd, 0xff, 0xff, 0xfb, 0xff, 0xb9, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
+    0xff, 0xff, 0x9c, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xde, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xef, 0xbd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7b, 0xef, 0xbd, 0xf7, 0xde, 0xfb, 0xff, 0xde, 0x7b,
+    0xef, 0xff, 0xff, 0xfe, 0x7f, 0xee, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0x3f, 0xe7, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x73, 0xef, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xbd, 0xf7, 0xef, 0xe5, 0x9c, 0x71, 0xce,
+    0x38, 0x63, 0x9c, 0x33, 0xce, 0x18, 0x67, 0x8c, 0x71, 0xce, 0x38, 0x63, 0x9c, 0x31, 0xc6, 0x19,
+    0x63, 0x7c, 0x72, 0xfe, 0xf9, 0xff, 0x8c, 0x31, 0xce, 0x18, 0x63, 0x9c, 0xbd, 0xf7, 0xde, 0xe7,
+    0xfc, 0xf3, 0xff, 0xf9, 0xff, 0x9f, 0xff, 0xff, 0x3f, 0x7b, 0xef, 0xbd, 0xcf, 0xde, 0x7b, 0xef,
+    0xff, 0x7b, 0xef, 0xbd, 0xff, 0xff, 0xfb, 0xff, 0xb9, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0xff, 0xff, 0xff, 0x9c, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0xce, 0xbd, 0xf7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0x97,
+    0x73, 0xfe, 0x39, 0xff, 0xfc, 0x4f, 0xce, 0x3f, 0xff, 0x9f, 0x31, 0x3e, 0x39, 0xff, 0xfc, 0x7f,
+    0xc6, 0x18, 0x67, 0x8c, 0xf1, 0xc9, 0xf9, 0xe7, 0xff, 0xf3, 0xff, 0x3f, 0xff, 0xff, 0x7f, 0xfe,
+    0xff, 0xff, 0x97, 0xf3, 0xcf, 0xff, 0xe7, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x2f,
+    0x7b, 0xef, 0xfd, 0x7b, 0x39, 0x67, 0x9c, 0x33, 0xce, 0xf8, 0xe4, 0x8c, 0x33, 0xc6, 0x19, 0xe3,
+    0x93, 0x33, 0xce, 0x18, 0x67, 0x8c, 0x71, 0xc6, 0x18, 0x9f, 0x9c, 0x7f, 0xfe, 0x3f, 0xff, 0xff,
+    0xf3, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x3f, 0x39, 0xff, 0xfc, 0x7f, 0xfe, 0xff, 0xe7, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xff, 0xb3, 0xf7, 0xde, 0x7b, 0xdf, 0x3b, 0xef, 0x9c, 0x77, 0xce, 0x79, 0xe7,
+    0x9c, 0xf3, 0xce, 0x39, 0xe7, 0xbc, 0x73, 0xce, 0x39, 0xe7, 0x9d, 0x73, 0xce, 0x39, 0xff, 0xef,
+    0xbd, 0xf7, 0xfe, 0xff, 0xef, 0xff, 0xe7, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0x73, 0xee, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x39, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x5e, 0xce, 0xf9,
+    0xe7, 0xfc, 0xf3, 0x3f, 0x39, 0xff, 0xfc, 0x7f, 0xfe, 0xff, 0xe4, 0xfc, 0xf3, 0xff, 0xf9, 0xff,
+    0x9f, 0xff, 0xff, 0x27, 0xe7, 0x9f, 0xff, 0xcf, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf9, 0xff, 0xff,
+    0x5f, 0xce, 0x3f, 0xff, 0x9f, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xbf, 0xfc, 0xff,
+    0xff, 0xef, 0xe5, 0x9c, 0x7f, 0xce, 0x3f, 0xff, 0x93, 0xf3, 0xcf, 0xff, 0xe7, 0xff, 0x4f, 0xce,
+    0x3f, 0xff, 0x9f, 0xff, 0xff, 0xf9, 0xff, 0x7f, 0x72, 0xfe, 0xf9, 0xff, 0xfc, 0xff, 0xcf, 0xff,
+    0xff, 0x9f, 0xff, 0xff, 0xff, 0xe4, 0xfc, 0xf3, 0xff, 0xf9, 0xff, 0x9f, 0xff, 0xff, 0x3f, 0xff,
+    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x5f, 0xef, 0xbc, 0x73, 0xde, 0x39, 0xe7, 0x9d, 0x73, 0xce,
+    0x3b, 0xe7, 0x9c, 0xf3, 0xce, 0x39, 0xe7, 0x9c, 0x77, 0xce, 0x39, 0xe7, 0x9c, 0xe7, 0x9c, 0x7f,
+    0xce, 0x3f, 0xff, 0x93, 0xf3, 0xcf, 0xff, 0xe7, 0xff, 0x4f, 0xce, 0x3f, 0xff, 0x9f, 0xff, 0xff,
+    0xf9, 0xff, 0x7f, 0x72, 0xfe, 0xf9, 0xff, 0xfc, 0xff, 0xcf, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+    0xe4, 0xfc, 0xf3, 0xff, 0xf9, 0xff, 0x9f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
+    0xff, 0x7f, 0xef, 0xbc, 0x73, 0xde, 0x39, 0xe7, 0x9d, 0x73, 0xce, 0x3b, 0xe7, 0x9c, 0xf3, 0xce,
+    0x39, 0xe7, 0x9c, 0x77, 0xce, 0x39, 0xe7, 0x9c, 0xf7, 0xce, 0x3b, 0xe7, 0x9d, 0x73, 0xde, 0x39,
+    0xe7, 0xbc, 0x73, 0xce, 0x39, 0xef, 0x9c, 0x73, 0xce, 0x79, 0xe7, 0x9c, 0x73, 0xce, 0xf9, 0xf7,
+    0xde, 0x7b, 0xef, 0xbd, 0x7f, 0xff, 0xff, 0xe7, 0x9c, 0x7b, 0xce, 0x7d, 0xf7, 0xdf, 0x39, 0xee,
+    0x1c, 0x77, 0x9c, 0x7b, 0xcc, 0x39, 0xe7, 0x9e, 0x73, 0xff, 0x9d, 0x73, 0xce, 0x39, 0xc7, 0x9d,
+    0xf3, 0xde, 0x71, 0xee, 0x38, 0xe7, 0x1e, 0x63, 0xcc, 0x39, 0xe7, 0x9c, 0x7b, 0xce, 0xb9, 0xf7,
+    0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x79, 0xef, 0xbc, 0x73, 0xdc, 0x39, 0xe7, 0xbd, 0xf7, 0xde,
+    0x71, 0xee, 0x1c, 0xe7, 0xdc, 0x79, 0xef, 0xbd, 0xf7, 0x9e, 0x73, 0xce, 0x39, 0xe7, 0xdc, 0x73,
+    0xce, 0xb9, 0xf7, 0x52, 0x4a, 0x27, 0xa5, 0x93, 0xce, 0x49, 0xe9, 0xa4, 0x73, 0xd2, 0x39, 0x27,
+    0xa5, 0x97, 0xde, 0x49, 0xef, 0x9c, 0xf4, 0xce, 0x39, 0x29, 0xbd, 0xf4, 0x5e, 0x7a, 0xef, 0x24,
+    0xe7, 0xce, 0x49, 0xce, 0xb9, 0xf3, 0x52, 0x7a, 0xe9, 0xbd, 0xf4, 0xde, 0x48, 0xce, 0x39, 0x97,
+    0x9c, 0x73, 0xee, 0x25, 0xe7, 0x9c, 0x7b, 0x2f, 0xa5, 0x74, 0x52, 0x3a, 0xe9, 0x9c, 0x94, 0x4e,
+    0x3a, 0x27, 0x9d, 0x73, 0x52, 0x7a, 0xe9, 0x9d, 0xf4, 0xce, 0x49, 0xe6, 0x9c, 0x93, 0xd2, 0x4b,
+    0xef, 0xa5, 0xf7, 0x4e, 0x7a, 0xef, 0x9c, 0xf4, 0xde, 0x39, 0x27, 0xa5, 0x97, 0xde, 0x4b, 0xef,
+    0x8d, 0xf4, 0xde, 0x3b, 0xe9, 0xbd, 0x77, 0x4e, 0x72, 0xce, 0xb9, 0xf3, 0x5a, 0x63, 0x8d, 0xb1,
+    0xc6, 0x18, 0x6b, 0x8c, 0x31, 0xd6, 0x18, 0x63, 0x8c, 0x35, 0xc6, 0x18, 0x63, 0xaf, 0x31, 0xc6,
+    0x18, 0x7b, 0x2f, 0xa5, 0x74, 0x52, 0x3a, 0xe9, 0x9c, 0x94, 0x4e, 0x3a, 0x27, 0x9d, 0x73, 0x52,
+    0x7a, 0xe9, 0x9d, 0xf4, 0xce, 0x49, 0xe6, 0x9c, 0x93, 0xd2, 0x4b, 0xef, 0xa5, 0xf7, 0x4e, 0x7a,
+    0xef, 0x9c, 0x64, 0xcc, 0x39, 0x27, 0xa5, 0x97, 0xde, 0x4b, 0xef, 0x8d, 0xf4, 0xde, 0x3b, 0xe9,
+    0xbd, 0x77, 0x4e, 0x7a, 0x31, 0x9e, 0x73, 0x5a, 0x63, 0x8d, 0xb1, 0xc6, 0x18, 0x6b, 0x8c, 0x31,
+    0xd6, 0x18, 0x63, 0x8c, 0x35, 0xc6, 0x18, 0x63, 0xac, 0x31, 0xc6, 0x18, 0x63, 0xaf, 0x35, 0xd6,
+    0x18, 0x6b, 0x8c, 0xb1, 0xc6, 0x18, 0x63, 0x8d, 0x31, 0xc6, 0x58, 0x63, 0x8c, 0x31, 0xc6, 0x1a,
+    0x63, 0x8c, 0x31, 0xf6, 0x9e, 0x73, 0xce, 0x39, 0xe7, 0x5c, 0x4a, 0xe9, 0xa4, 0x74, 0xd2, 0x39,
+    0x29, 0x9d, 0x74, 0x4e, 0x3a, 0xe7, 0xa4, 0xf4, 0xd2, 0x3b, 0xe9, 0x9d, 0x93, 0xcc, 0x39, 0x27,
+    0xa5, 0x97, 0xde, 0x4b, 0xef, 0x9d, 0xf4, 0xde, 0x39, 0xc9, 0x98, 0x73, 0x4e, 0x4a, 0x2f, 0xbd,
+    0x97, 0xde, 0x1b, 0xe9, 0xbd, 0x77, 0xd2, 0x7b, 0xef, 0x9c, 0xf4, 0x62, 0x3c, 0xe7, 0xb4, 0xc6,
+    0x1a, 0x63, 0x8d, 0x31, 0xd6, 0x18, 0x63, 0xac, 0x31, 0xc6, 0x18, 0x6b, 0x8c, 0x31, 0xc6, 0x58,
+    0x63, 0x8c, 0x31, 0xc6, 0x58, 0x6b, 0xac, 0x31, 0xd6, 0x18, 0x63, 0x8d, 0x31, 0xc6, 0x1a, 0x63,
+    0x8c, 0xb1, 0xc6, 0x18, 0x63, 0x8c, 0x35, 0xc6, 0x18, 0x63, 0x8c, 0x3d, 0xe7, 0x9c, 0x73, 0xce,
+    0xb9, 0xd6, 0x58, 0x63, 0xac, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0x35, 0xc6, 0x18, 0x63, 0x8d, 0x31,
+    0xc6, 0x18, 0x6b, 0x8c, 0x31, 0xc6, 0x18, 0x7b, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xcf, 0x39, 0xe7,
+    0x9c, 0x73, 0xee, 0xfd, 0xff, 0xff, 0x73, 0xce, 0x7d, 0xe7, 0xbe, 0xfb, 0xef, 0x9c, 0x73, 0xce,
+    0x39, 0xee, 0xfc, 0xe7, 0x9c, 0x73, 0xdf, 0xb9, 0xff, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x79,
+    0xef, 0xbc, 0x73, 0x9c, 0x3b, 0xff, 0xbd, 0xf7, 0xde, 0x73, 0xce, 0x7d, 0xe7, 0xdc, 0x7f, 0xe7,
+    0x9c, 0x73, 0xce, 0x39, 0xe7, 0xbc, 0x77, 0xde, 0x39, 0xef, 0x9c, 0xf3, 0xde, 0x7b, 0xef, 0xbd,
+    0x77, 0x8e, 0x73, 0xee, 0xbc, 0xf7, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0x9c, 0x73, 0xee, 0x3b, 0xe7,
+    0xdc, 0x7f, 0x29, 0xa5, 0x93, 0xd2, 0x49, 0xe7, 0xa4, 0x74, 0xd2, 0x39, 0xe9, 0x9c, 0x93, 0xd2,
+    0x4b, 0xef, 0xa5, 0x77, 0x4e, 0x7a, 0xe7, 0x9c, 0x94, 0x5e, 0x7a, 0x2f, 0xbd, 0xf7, 0xd2, 0x7b,
+    0xef, 0x24, 0xe7, 0xdc, 0x79, 0x29, 0xbd, 0xf4, 0x5e, 0x7a, 0x6f, 0xa4, 0xf7, 0x1e, 0x4c, 0xce,
+    0x39, 0xf7, 0x92, 0x73, 0xce, 0xfd, 0x97, 0x52, 0x3a, 0x29, 0x9d, 0x74, 0x4e, 0x4a, 0x27, 0x9d,
+    0x93, 0xce, 0x39, 0x29, 0xbd, 0xf4, 0x5e, 0x7a, 0xe7, 0xa4, 0x77, 0xce, 0x49, 0xe9, 0xa5, 0xf7,
+    0xd2, 0x7b, 0x2f, 0xbd, 0xf7, 0x4e, 0x7a, 0xef, 0x9d, 0x93, 0xd2, 0x4b, 0xef, 0xa5, 0xf7, 0x46,
+    0x82, 0xef, 0xc1, 0x04, 0x61, 0x84, 0x27, 0x39, 0xe7, 0x1c, 0x7c, 0xad, 0xb1, 0xc6, 0x58, 0x63,
+    0x8c, 0x35, 0xc6, 0x18, 0x6b, 0x8c, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0xb1, 0xd7, 0x18, 0x63, 0x8c,
+    0xbd, 0x97, 0x52, 0x3a, 0x29, 0x9d, 0x74, 0x4e, 0x4a, 0x27, 0x9d, 0x93, 0xce, 0x39, 0x29, 0xbd,
+    0xf4, 0x5e, 0x7a, 0xe7, 0xa4, 0x77, 0xce, 0x49, 0xe9, 0xa5, 0xf7, 0xd2, 0x7b, 0x2f, 0xbd, 0xf7,
+    0x4e, 0x7a, 0xef, 0x9d, 0x93, 0xd2, 0x4b, 0xef, 0x25, 0xf8, 0x46, 0x82, 0xef, 0xc1, 0x04, 0x61,
+    0x84, 0x30, 0xc1, 0x18, 0x21, 0x3c, 0xad, 0xb1, 0xc6, 0x58, 0x63, 0x8c, 0x35, 0xc6, 0x18, 0x6b,
+    0x8c, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0x31, 0xd6, 0x18, 0x63, 0x8c, 0xb1, 0xd7, 0x1a, 0x6b, 0x8c,
+    0x35, 0xc6, 0x58, 0x63, 0x8c, 0xb1, 0xc6, 0x18, 0x63, 0xac, 0x31, 0xc6, 0x18, 0x63, 0x8d, 0x31,
+    0xc6, 0x18, 0x7b, 0xcf, 0x39, 0xe7, 0x9c, 0x73, 0x2e, 0xa5, 0x74, 0x52, 0x3a, 0xe9, 0x9c, 0x94,
+    0x4e, 0x3a, 0x27, 0x9d, 0x73, 0x52, 0x7a, 0xe9, 0xbd, 0xf4, 0xce, 0x49, 0xef, 0x9c, 0x93, 0xd2,
+    0x4b, 0xef, 0xa5, 0xf7, 0x5e, 0x7a, 0xef, 0x9d, 0xf4, 0xde, 0x3b, 0x27, 0xa5, 0x97, 0xde, 0x4b,
+    0xf0, 0x8d, 0x04, 0xdf, 0x83, 0x09, 0xc2, 0x08, 0x61, 0x82, 0x31, 0x42, 0x78, 0x5a, 0x63, 0x8d,
+    0xb1, 0xc6, 0x18, 0x6b, 0x8c, 0x31, 0xd6, 0x18, 0x63, 0x8c, 0x35, 0xc6, 0x18, 0x63, 0xac, 0x31,
+    0xc6, 0x18, 0x63, 0xac, 0x35, 0xd6, 0x18, 0x6b, 0x8c, 0xb1, 0xc6, 0x18, 0x63, 0x8d, 0x31, 0xc6,
+    0x58, 0x63, 0x8c, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0x31, 0xc6, 0x9e, 0x73, 0xce, 0x39, 0xe7, 0x5c,
+    0x6b, 0xac, 0x31, 0xd6, 0x18, 0x63, 0x8d, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0xb1, 0xc6, 0x18, 0x63,
+    0x8c, 0x35, 0xc6, 0x18, 0x63, 0x8c, 0x3d, 0xe7, 0x9c, 0x73, 0xce, 0xb9, 0xe7, 0x9c, 0x73, 0xce,
+    0x39, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xfa, 0xeb, 0xff, 0xf3, 0xff, 0x5f, 0x6b,
+    0xad, 0xb5, 0xce, 0xf9, 0xff, 0x9c, 0xff, 0xff, 0x5a, 0x6b, 0xad, 0x75, 0xce, 0x39, 0xe7, 0x9c,
+    0xf3, 0xcf, 0x39, 0xe7, 0xff, 0xb5, 0xd6, 0x5a, 0xeb, 0x9c, 0x73, 0xce, 0x39, 0x67, 0x9c, 0x73,
+    0xce, 0x18, 0xe7, 0x9c, 0x33, 0xc6, 0x58, 0x6b, 0xad, 0xb5, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xc6,
+    0x39, 0xe7, 0x8c, 0x71, 0xce, 0x39, 0x63, 0x8c, 0x73, 0xce, 0x19, 0x63, 0x8c, 0xb5, 0xd6, 0x5a,
+    0xeb, 0x9c, 0x73, 0xce, 0x39, 0x67, 0x9c, 0x73, 0xce, 0x18, 0xe7, 0x9c, 0x33, 0xc6, 0x38, 0xe7,
+    0x9c, 0x31, 0xc6, 0xf8, 0x98, 0x9c, 0x8d, 0xc1, 0x18, 0x6b, 0xad, 0xb5, 0xd6, 0x39, 0xe7, 0x9c,
+    0x73, 0xce, 0x38, 0xe7, 0x9c, 0x31, 0xce, 0x39, 0x67, 0x8c, 0x71, 0xce, 0x39, 0x63, 0x8c, 0xf1,
+    0xc9, 0x39, 0x1b, 0x8c, 0x31, 0x3e, 0x39, 0x67, 0x63, 0x0c, 0xc6, 0x47, 0x6b, 0xad, 0xb5, 0xce,
+    0x39, 0xe7, 0x9c, 0x73, 0xc6, 0x39, 0xe7, 0x8c, 0x71, 0xce, 0x39, 0x63, 0x8c, 0x73, 0xce, 0x19,
+    0x63, 0x8c, 0x4f, 0xce, 0x19, 0x63, 0x8c, 0xf1, 0xc9, 0x39, 0x63, 0x8c, 0x31, 0x3e, 0x27, 0xe7,
+    0x8c, 0x31, 0xc6, 0xf8, 0x9c, 0xff, 0xff, 0x7f, 0xce, 0xb9, 0xef, 0xdc, 0x77, 0xff, 0x9d, 0x73,
+    0xce, 0x39, 0xc7, 0x9d, 0xff, 0x9c, 0x73, 0xee, 0x3b, 0xf7, 0xdf, 0x39, 0xe7, 0x9c, 0x73, 0xce,
+    0x39, 0xef, 0x9d, 0x77, 0x8e, 0x73, 0xe7, 0xbf, 0xf7, 0xde, 0x7b, 0xce, 0xb9, 0xef, 0x9c, 0xfb,
+    0xef, 0x9c, 0x73, 0xce, 0x39, 0xe7, 0x9c, 0xf7, 0xce, 0x3b, 0xe7, 0x9d, 0x73, 0xde, 0x7b, 0xef,
+    0xbd, 0xf7, 0xce, 0x71, 0xee, 0x9c, 0xff, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0x9e, 0x73, 0xce, 0x7d,
+    0xe7, 0x9c, 0xfb, 0x2f, 0xa5, 0x74, 0x52, 0x3a, 0xe9, 0x9c, 0x94, 0x4e, 0x3a, 0x27, 0x9d, 0x73,
+    0x52, 0x7a, 0xe9, 0xbd, 0xf4, 0xce, 0x49, 0xef, 0x9c, 0x93, 0xd2, 0x4b, 0xef, 0xa5, 0xf7, 0x5e,
+    0x82, 0xef, 0x9d, 0xe4, 0x9c, 0x3b, 0x3f, 0xa5, 0x97, 0xde, 0x4b, 0xf0, 0x8d, 0x04, 0xe1, 0x83,
+    0xc9, 0x39, 0x07, 0x7f, 0x72, 0xce, 0xb9, 0xff, 0x52, 0x4a, 0x27, 0xa5, 0x93, 0xce, 0x49, 0xe9,
+    0xa4, 0x73, 0xd2, 0x39, 0x27, 0xa5, 0x97, 0xde, 0x4b, 0xef, 0x9c, 0xf4, 0xce, 0x39, 0x29, 0xbd,
+    0xf4, 0x5e, 0x7a, 0xef, 0xa5, 0xf7, 0xde, 0x49, 0xef, 0xbd, 0x73, 0x52, 0x7a, 0xe9, 0xbd, 0x04,
+    0xdf, 0x48, 0xf0, 0x3d, 0x98, 0x20, 0x8c, 0x10, 0x26, 0x18, 0x23, 0x84, 0xbf, 0x35, 0xd6, 0x18,
+    0x6b, 0x8c, 0xb1, 0xc6, 0x18, 0x63, 0x8d, 0x31, 0xc6, 0x58, 0x63, 0x8c, 0x31, 0xf6, 0x1b, 0x63,
+    0x8c, 0xb1, 0xff, 0x52, 0x4a, 0x27, 0xa5, 0x93, 0xce, 0x49, 0xe9, 0xa4, 0x73, 0xd2, 0x39, 0x27,
+    0xa5, 0x97, 0xde, 0x4b, 0xef, 0x9c, 0xf4, 0xce, 0x39, 0x29, 0xbd, 0xf4, 0x5e, 0x7a, 0xef, 0x25,
+    0xf8, 0xde, 0x49, 0x10, 0xc2, 0x73, 0x52, 0x7a, 0xe9, 0xbd, 0x04, 0xe1, 0x48, 0x10, 0x42, 0x98,
+    0x20, 0x84, 0x10, 0x26, 0x18, 0x23, 0x84, 0xa7, 0x35, 0xd6, 0x18, 0x6b, 0x8c, 0xb1, 0xc6, 0x18,
+    0x63, 0x8d, 0x31, 0xc6, 0x58, 0x63, 0x8c, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0x31, 0xf6, 0x5a, 0x63,
+    0x8d, 0xb1, 0xc6, 0x18, 0x6b, 0x8c, 0x31, 0xd6, 0x18, 0x63, 0x8c, 0x35, 0xc6, 0x18, 0x63, 0xac,
+    0x31, 0xc6, 0x18, 0x63, 0xff, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0xa5, 0x94, 0x4e, 0x4a, 0x27, 0x9d,
+    0x93, 0xd2, 0x49, 0xe7, 0xa4, 0x73, 0x4e, 0x4a, 0x2f, 0xbd, 0x97, 0xde, 0x39, 0x09, 0x9e, 0x73,
+    0x52, 0x7a, 0xe9, 0xbd, 0x04, 0xdf, 0x4b, 0xf0, 0xbd, 0x93, 0x20, 0x84, 0xe7, 0xa4, 0xf4, 0xd2,
+    0x7b, 0x09, 0xc2, 0x91, 0x20, 0x84, 0x30, 0x41, 0x08, 0x21, 0x4c, 0x30, 0x46, 0x08, 0x4f, 0x6b,
+    0xac, 0x31, 0xd6, 0x18, 0x63, 0x8d, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0xb1, 0xc6, 0x18, 0x63, 0x8c,
+    0x35, 0xc6, 0x18, 0x63, 0x8c, 0xb5, 0xc6, 0x1a, 0x63, 0x8d, 0x31, 0xd6, 0x18, 0x63, 0xac, 0x31,
+    0xc6, 0x18, 0x6b, 0x8c, 0x31, 0xc6, 0x58, 0x63, 0x8c, 0x31, 0xc6, 0xd8, 0x73, 0xce, 0x39, 0xe7,
+    0x9c, 0x6b, 0x8d, 0x35, 0xc6, 0x1a, 0x63, 0xac, 0x31, 0xc6, 0x58, 0x63, 0x8c, 0x31, 0xd6, 0x18,
+    0x63, 0x8c, 0xb1, 0xc6, 0x18, 0x63, 0x8c, 0xb1, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0xf7, 0x9c, 0x73,
+    0xce, 0x39, 0xe7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x7f, 0xfd, 0x7f, 0xfe, 0xff,
+    0x6b, 0xad, 0xb5, 0xd6, 0x39, 0xff, 0x9f, 0xf3, 0xff, 0x5f, 0x6b, 0xad, 0xb5, 0xce, 0x39, 0xe7,
+    0x9c, 0x73, 0xfe, 0x39, 0xe7, 0xfc, 0xbf, 0xd6, 0x5a, 0x6b, 0x9d, 0x73, 0xce, 0x39, 0xe7, 0x8c,
+    0x73, 0xce, 0x19, 0xe3, 0x9c, 0x73, 0xc6, 0x18, 0x6b, 0xad, 0xb5, 0xd6, 0x39, 0xe7, 0x9c, 0x73,
+    0xce, 0x38, 0xe7, 0x9c, 0x31, 0xce, 0x39, 0x67, 0x8c, 0x71, 0xce, 0x39, 0x63, 0x8c, 0xb1, 0xd6,
+    0x5a, 0x6b, 0x9d, 0x73, 0xce, 0x39, 0xe7, 0x8c, 0x73, 0xce, 0x19, 0xe3, 0x9c, 0x73, 0xc6, 0x18,
+    0xe7, 0x9c, 0x33, 0xc6, 0x18, 0x9f, 0x9c, 0xb3, 0x31, 0x18, 0x63, 0xad, 0xb5, 0xd6, 0x3a, 0xe7,
+    0x9c, 0x73, 0xce, 0x19, 0xe7, 0x9c, 0x33, 0xc6, 0x39, 0xe7, 0x8c, 0x31, 0xce, 0x39, 0x67, 0x8c,
+    0x31, 0x3e, 0x39, 0x67, 0x8c, 0x31, 0xc6, 0x27, 0xe7, 0x8c, 0x31, 0xc6, 0xf8, 0x68, 0xad, 0xb5,
+    0xd6, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x38, 0xe7, 0x9c, 0x31, 0xce, 0x39, 0x67, 0x8c, 0x71, 0xce,
+    0x39, 0x63, 0x8c, 0xf1, 0xc9, 0x39, 0x63, 0x8c, 0x31, 0x3e, 0x39, 0x67, 0x8c, 0x31, 0xc6, 0xe7,
+    0xe4, 0x9c, 0x31, 0xc6, 0x18, 0x9f, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xd6, 0x5f, 0xff,
+    0x9f, 0xff, 0xff, 0x5a, 0x6b, 0xad, 0x7f, 0xce, 0xff, 0xe7, 0xfc, 0xff, 0xd7, 0x5a, 0x6b, 0xad,
+    0x73, 0xce, 0x3f, 0xe7, 0xfc, 0x7f, 0xce, 0xf9, 0xff, 0xaf, 0xb5, 0xd6, 0x5a, 0xe7, 0x9c, 0x73,
+    0xce, 0x39, 0xff, 0x9c, 0x73, 0xfe, 0x3f, 0xe7, 0x9c, 0xff, 0xff, 0x5a, 0x6b, 0xad, 0x75, 0xce,
+    0x39, 0xe7, 0x9c, 0x33, 0xce, 0x39, 0x67, 0x8c, 0x71, 0xce, 0x19, 0xff, 0x8f, 0x73, 0xce, 0xf8,
+    0xff, 0xaf, 0xb5, 0xd6, 0x5a, 0xe3, 0x9c, 0x73, 0xce, 0x39, 0xe3, 0x9c, 0x73, 0xc6, 0x18, 0xe7,
+    0x9c, 0x31, 0xc6, 0x38, 0xe7, 0x8c, 0x31, 0xfe, 0x07, 0xe7, 0x8c, 0x31, 0xfe, 0x5f, 0x6b, 0xad,
+    0xb5, 0xc6, 0x38, 0xe7, 0x9c, 0x73, 0xc6, 0x38, 0xe7, 0x8c, 0x31, 0xce, 0x39, 0x63, 0x8c, 0x71,
+    0xce, 0x19, 0x63, 0x8c, 0x0f, 0xce, 0x19, 0x63, 0x8c, 0xf1, 0xc1, 0x39, 0x63, 0x8c, 0x31, 0x3e,
+    0x5a, 0x6b, 0xad, 0x35, 0xc6, 0x39, 0xe7, 0x9c, 0x33, 0xc6, 0x39, 0x67, 0x8c, 0x71, 0xce, 0x19,
+    0x63, 0x8c, 0x73, 0xce, 0x18, 0x63, 0x7c, 0x70, 0xce, 0x18, 0x63, 0x8c, 0x0f, 0xce, 0x19, 0x63,
+    0x8c, 0xf1, 0x39, 0x18, 0x67, 0x8c, 0x31, 0xc6, 0xe7, 0x78, 0xef, 0xbd, 0xf7, 0xbd, 0xf7, 0xde,
+    0x7b, 0xef, 0xbc, 0xf7, 0xde, 0x39, 0xef, 0xbd, 0x77, 0xce, 0x79, 0xef, 0xbd, 0x73, 0xce, 0x79,
+    0xef, 0xbd, 0x73, 0xce, 0x39, 0xef, 0xbd, 0x77, 0xce, 0x39, 0xe7, 0xbc, 0xf7, 0xde, 0x39, 0xe7,
+    0x9c, 0x73, 0xde, 0x7b, 0xef, 0x9c, 0x73, 0xce, 0x39, 0xe7, 0xff, 0xff, 0xff, 0x9c, 0x73, 0xdf,
+    0xb9, 0xef, 0xfe, 0x3b, 0xe7, 0x9c, 0x73, 0x8e, 0x3b, 0xff, 0x39, 0xe7, 0xdc, 0x77, 0xee, 0xbf,
+    0x73, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xde, 0x3b, 0xef, 0x1c, 0xe7, 0xce, 0x7f, 0xef, 0xbd, 0xf7,
+    0x9c, 0x73, 0xdf, 0x39, 0xf7, 0xdf, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0xef, 0x9d, 0x77, 0xce,
+    0x3b, 0xe7, 0xbc, 0xf7, 0xde, 0x7b, 0xef, 0x9d, 0xe3, 0xdc, 0x39, 0xff, 0xbd, 0xf7, 0xde, 0x7b,
+    0xef, 0x3d, 0xe7, 0x9c, 0xfb, 0xce, 0x39, 0xf7, 0x5f, 0x4a, 0xe9, 0xa4, 0x74, 0xd2, 0x39, 0x29,
+    0x9d, 0x74, 0x4e, 0x3a, 0xe7, 0xa4, 0xf4, 0xd2, 0x7b, 0xe9, 0x9d, 0x93, 0xde, 0x39, 0x27, 0xa5,
+    0x97, 0xde, 0x4b, 0xef, 0xbd, 0x04, 0xdf, 0x3b, 0xc9, 0x39, 0x77, 0x7e, 0x4a, 0x2f, 0xbd, 0x97,
+    0xe0, 0x1b, 0x09, 0xc2, 0x07, 0x93, 0x73, 0x0e, 0xfe, 0xe4, 0x9c, 0x73, 0xff, 0xa5, 0x94, 0x4e,
+    0x4a, 0x27, 0x9d, 0x93, 0xd2, 0x49, 0xe7, 0xa4, 0x73, 0x4e, 0x4a, 0x2f, 0xbd, 0x97, 0xde, 0x39,
+    0xe9, 0x9d, 0x73, 0x52, 0x7a, 0xe9, 0xbd, 0xf4, 0xde, 0x4b, 0xef, 0xbd, 0x93, 0xde, 0x7b, 0xe7,
+    0xa4, 0xf4, 0xd2, 0x7b, 0x09, 0xbe, 0x91, 0x20, 0x7c, 0x30, 0x41, 0x08, 0x21, 0x4c, 0x30, 0x46,
+    0x08, 0x7f, 0x6b, 0xac, 0x31, 0xd6, 0x18, 0x63, 0x8d, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0xb1, 0xc6,
+    0x18, 0x63, 0xec, 0x37, 0xc6, 0x18, 0x63, 0xff, 0xa5, 0x94, 0x4e, 0x4a, 0x27, 0x9d, 0x93, 0xd2,
+    0x49, 0xe7, 0xa4, 0x73, 0x4e, 0x4a, 0x2f, 0xbd, 0x97, 0xde, 0x39, 0xe9, 0x9d, 0x73, 0x52, 0x7a,
+    0xe9, 0xbd, 0x04, 0xdf, 0x4b, 0xf0, 0xbd, 0x93, 0x20, 0x84, 0xe7, 0xa4, 0xf4, 0xd2, 0x7b, 0x09,
+    0xc2, 0x91, 0x20, 0x84, 0x30, 0x41, 0x08, 0x21, 0x4c, 0x30, 0x46, 0x08, 0x4f, 0x6b, 0xac, 0x31,
+    0xd6, 0x18, 0x63, 0x8d, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0xb1, 0xc6, 0x18, 0x63, 0x8c, 0x35, 0xc6,
+    0x18, 0x63, 0xec, 0xb7, 0xc6, 0x1a, 0x63, 0x8d, 0x31, 0xd6, 0x18, 0x63, 0xac, 0x31, 0xc6, 0x18,
+    0x6b, 0x8c, 0x31, 0xc6, 0x58, 0x63, 0x8c, 0x31, 0xc6, 0xfe, 0x73, 0xce, 0x39, 0xe7, 0x9c, 0x4b,
+    0x29, 0x9d, 0x94, 0x4e, 0x3a, 0x27, 0xa5, 0x93, 0xce, 0x49, 0xe7, 0x9c, 0x94, 0x5e, 0x7a, 0x2f,
+    0xc1, 0x73, 0x12, 0x3c, 0xe7, 0xa4, 0xf4, 0xd2, 0x7b, 0x09, 0xbe, 0x97, 0x20, 0x84, 0x27, 0x41,
+    0x08, 0xcf, 0x49, 0xe9, 0xa5, 0xf7, 0x12, 0x84, 0x23, 0x41, 0x08, 0x61, 0x82, 0x10, 0x42, 0x98,
+    0x60, 0x8c, 0x10, 0x9e, 0xd6, 0x58, 0x63, 0xac, 0x31, 0xc6, 0x1a, 0x63, 0x8c, 0x35, 0xc6, 0x18,
+    0x63, 0x8d, 0x31, 0xc6, 0x18, 0x6b, 0x8c, 0x31, 0xc6, 0x18, 0x6b, 0x8d, 0x35, 0xc6, 0x1a, 0x63,
+    0xac, 0x31, 0xc6, 0x58, 0x63, 0x8c, 0x31, 0xd6, 0x18, 0x63, 0x8c, 0xb1, 0xc6, 0x18, 0x63, 0x8c,
+    0xb1, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0xd7, 0x1a, 0x6b, 0x8c, 0x35, 0xc6, 0x58, 0x63, 0x8c, 0xb1,
+    0xc6, 0x18, 0x63, 0xac, 0x31, 0xc6, 0x18, 0x63, 0x8d, 0x31, 0xc6, 0x18, 0x63, 0xcf, 0x39, 0xe7,
+    0x9c, 0x73, 0xee, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5,
+    0xfe, 0xfa, 0xff, 0xfc, 0xff, 0xd7, 0x5a, 0x6b, 0xad, 0x73, 0xfe, 0x3f, 0xe7, 0xff, 0xbf, 0xd6,
+    0x5a, 0x6b, 0x9d, 0x73, 0xce, 0x39, 0xe7, 0xfc, 0x73, 0xce, 0xf9, 0x7f, 0xad, 0xb5, 0xd6, 0x3a,
+    0xe7, 0x9c, 0x73, 0xce, 0x19, 0xe7, 0x9c, 0x33, 0xc6, 0x39, 0xe7, 0x8c, 0x31, 0xd6, 0x5a, 0x6b,
+    0xad, 0x73, 0xce, 0x39, 0xe7, 0x9c, 0x71, 0xce, 0x39, 0x63, 0x9c, 0x73, 0xce, 0x18, 0xe3, 0x9c,
+    0x73, 0xc6, 0x18, 0x63, 0xad, 0xb5, 0xd6, 0x3a, 0xe7, 0x9c, 0x73, 0xce, 0x19, 0xe7, 0x9c, 0x33,
+    0xc6, 0x39, 0xe7, 0x8c, 0x31, 0xce, 0x39, 0x67, 0x8c, 0x31, 0x3e, 0x39, 0x67, 0x8c, 0x31, 0xc6,
+    0x5a, 0x6b, 0xad, 0x75, 0xce, 0x39, 0xe7, 0x9c, 0x33, 0xce, 0x39, 0x67, 0x8c, 0x73, 0xce, 0x19,
+    0x63, 0x9c, 0x73, 0xce, 0x18, 0x63, 0x7c, 0x72, 0xce, 0x18, 0x63, 0x8c, 0x4f, 0xce, 0x19, 0x63,
+    0x8c, 0xf1, 0xd1, 0x5a, 0x6b, 0xad, 0x73, 0xce, 0x39, 0xe7, 0x9c, 0x71, 0xce, 0x39, 0x63, 0x9c,
+    0x73, 0xce, 0x18, 0xe3, 0x9c, 0x73, 0xc6, 0x18, 0xe3, 0x93, 0x73, 0xc6, 0x18, 0x63, 0x7c, 0x72,
+    0xce, 0x18, 0x63, 0x8c, 0xcf, 0xc9, 0x39, 0x63, 0x8c, 0x31, 0x3e, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x7f, 0xad, 0xbf, 0xfe, 0x3f, 0xff, 0xff, 0xb5, 0xd6, 0x5a, 0xff, 0x9c, 0xff, 0xcf, 0xf9,
+    0xff, 0xaf, 0xb5, 0xd6, 0x5a, 0xe7, 0x9c, 0x7f, 0xce, 0xf9, 0xff, 0x9c, 0xf3, 0xff, 0x5f, 0x6b,
+    0xad, 0xb5, 0xce, 0x39, 0xe7, 0x9c, 0x73, 0xfe, 0x39, 0xe7, 0xfc, 0x7f, 0xce, 0x39, 0xff, 0xff,
+    0xb5, 0xd6, 0x5a, 0xeb, 0x9c, 0x73, 0xce, 0x39, 0x67, 0x9c, 0x73, 0xce, 0x18, 0xe3, 0x9c, 0x33,
+    0xfe, 0x1f, 0xe7, 0x9c, 0xf1, 0xff, 0x5f, 0x6b, 0xad, 0xb5, 0xc6, 0x39, 0xe7, 0x9c, 0x73, 0xc6,
+    0x39, 0xe7, 0x8c, 0x31, 0xce, 0x39, 0x63, 0x8c, 0x71, 0xce, 0x19, 0x63, 0xfc, 0x0f, 0xce, 0x19,
+    0x63, 0xfc, 0xbf, 0xd6, 0x5a, 0x6b, 0x8d, 0x71, 0xce, 0x39, 0xe7, 0x8c, 0x71, 0xce, 0x19, 0x63,
+    0x9c, 0x73, 0xc6, 0x18, 0xe3, 0x9c, 0x33, 0xc6, 0x18, 0x1f, 0x9c, 0x33, 0xc6, 0x18, 0xe3, 0x83,
+    0x73, 0xc6, 0x18, 0x63, 0x7c, 0xb4, 0xd6, 0x5a, 0x6b, 0x8c, 0x73, 0xce, 0x39, 0x67, 0x8c, 0x73,
+    0xce, 0x18, 0xe3, 0x9c, 0x33, 0xc6, 0x18, 0xe7, 0x9c, 0x31, 0xc6, 0xf8, 0xe0, 0x9c, 0x31, 0xc6,
+    0x18, 0x1f, 0x9c, 0x33, 0xc6, 0x18, 0xe3, 0x73, 0x30, 0xce, 0x18, 0x63, 0x8c, 0xcf, 0xf1, 0xde,
+    0x7b, 0xef, 0x7b, 0xef, 0xbd, 0xf7, 0xde, 0x79, 0xef, 0xbd, 0x73, 0xde, 0x7b, 0xef, 0x9c, 0xf3,
+    0xde, 0x7b, 0xe7, 0x9c, 0xf3, 0xde, 0x7b, 0xe7, 0x9c, 0x73, 0xde, 0x7b, 0xef, 0x9c, 0x73, 0xce,
+    0x79, 0xef, 0xbd, 0x73, 0xce, 0x39, 0xe7, 0xbc, 0xf7, 0xde, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf9, 0xeb, 0xff, 0xf3, 0xff, 0x5f, 0x6b, 0xad, 0xf5, 0xcf,
+    0xf8, 0xff, 0x9c, 0xff, 0xff, 0x5a, 0x6b, 0xad, 0x35, 0xc6, 0xf9, 0x67, 0x9c, 0xff, 0xcf, 0x39,
+    0xff, 0xff, 0xb5, 0xd6, 0x5a, 0x6b, 0x8c, 0x73, 0xce, 0x38, 0xe7, 0x9f, 0x73, 0xce, 0xff, 0xe7,
+    0x9c, 0xf3, 0xff, 0x5f, 0x6b, 0xad, 0xb5, 0xc6, 0x38, 0xe7, 0x8c, 0x73, 0xc6, 0x39, 0xe7, 0x8c,
+    0x7f, 0xce, 0x39, 0xe3, 0xff, 0x31, 0xce, 0x19, 0xff, 0xff, 0xb5, 0xd6, 0x5a, 0x6b, 0x8c, 0x73,
+    0xce, 0x38, 0x67, 0x8c, 0x73, 0xce, 0x18, 0xe3, 0x9c, 0x33, 0xc6, 0x1f, 0xe3, 0x9c, 0x31, 0xfe,
+    0xff, 0xe0, 0x9c, 0x31, 0xfe, 0xff, 0x6b, 0xad, 0xb5, 0xd6, 0x18, 0xe3, 0x8c, 0x71, 0xce, 0x18,
+    0xe7, 0x9c, 0x31, 0xc6, 0x38, 0x67, 0x8c, 0x31, 0xc6, 0x39, 0x63, 0x8c, 0xff, 0xc1, 0x39, 0x63,
+    0x8c, 0xff, 0x3f, 0x38, 0x67, 0x8c, 0xf1, 0xff, 0x07, 0x6b, 0xad, 0xb5, 0xc6, 0x18, 0x67, 0x8c,
+    0x71, 0xc6, 0x38, 0xe7, 0x8c, 0x31, 0xc6, 0x39, 0x63, 0x8c, 0x31, 0xce, 0x19, 0x63, 0x8c, 0x0f,
+    0xce, 0x19, 0x63, 0x8c, 0xf1, 0xc1, 0x38, 0x63, 0x8c, 0xf1, 0x3f, 0x07, 0xe3, 0x8c, 0x31, 0xc6,
+    0xff, 0x1c, 0xef, 0xbd, 0xf7, 0xbe, 0xf7, 0xde, 0x7b, 0xef, 0x9d, 0xf7, 0xde, 0x3b, 0xe7, 0xbd,
+    0xf7, 0xce, 0x39, 0xef, 0xbd, 0x77, 0xce, 0x39, 0xef, 0xbd, 0x77, 0xce, 0x39, 0xe7, 0xbd, 0xf7,
+    0xce, 0x39, 0xe7, 0x9c, 0xf7, 0xde, 0x3b, 0xe7, 0x9c, 0x73, 0xce, 0x7b, 0xef, 0x9d, 0x73, 0xce,
+    0x39, 0xe7, 0xdc, 0x7b, 0xef, 0xbd, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xe7, 0xbd, 0xf7, 0xce, 0x79,
+    0xef, 0xbd, 0x73, 0xce, 0x7b, 0xef, 0x9d, 0x73, 0xce, 0x7b, 0xef, 0x9d, 0x73, 0xce, 0x79, 0xef,
+    0xbd, 0x73, 0xce, 0x39, 0xe7, 0xbd, 0xf7, 0xce, 0x39, 0xe7, 0x9c, 0xf3, 0xde, 0x7b, 0xe7, 0x9c,
+    0x73, 0xce, 0x39, 0xff, 0xff, 0x7f, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0x0f,
+};
+
+// The breaks above the starting jackpot, 4308 of 6188 hands have any, by hand_rank(mask) and jackpot: from the
+// jackpot of HOLD_BREAKS >> (HOLD_BREAK_RANK_BITS + HOLD_BITS) on, up to the next break of the hand, the best
+// hold is the low HOLD_BITS bits rather than the one of HOLD_TABLE. The HOLD_BREAK_RANK_BITS bits between are
+// the low bits of the rank, HOLD_BREAK_BUCKETS[rank >> HOLD_BREAK_RANK_BITS] is the first break of the ranks
+// with the high bits.
+typedef uint32_t hold_break_t;
+
+static const uint32_t HOLD_BREAK_BUCKETS[(HAND_COUNT >> HOLD_BREAK_RANK_BITS) + 2] = {
+    0, 64, 128, 192, 256, 320, 378, 396, 458, 522, 557, 584, 621, 662, 726, 771,
+    814, 860, 876, 916, 916, 973, 1037, 1078, 1119, 1154, 1184, 1213, 1219, 1262, 1271, 1271,
+    1317, 1381, 1425, 1467, 1509, 1532, 1568, 1570, 1608, 1626, 1626, 1661, 1725, 1785, 1842, 1900,
+    1964, 2023, 2066, 2107, 2134, 2172, 2193, 2204, 2250, 2250, 2250, 2308, 2372, 2433, 2494, 2552,
+    2616, 2680, 2740, 2800, 2862, 2926, 2990, 3034, 3076, 3116, 3140, 3175, 3177, 3217, 3233, 3233,
+    3270, 3334, 3397, 3458, 3516, 3580, 3644, 3707, 3767, 3826, 3890, 3954, 4018, 4079, 4138, 4200,
+    4264, 4308,
+};
+
+static const hold_break_t HOLD_BREAKS[HOLD_BREAK_COUNT] = {
+    0x008b9001, 0x001b6821, 0x001f4841, 0x001f4861, 0x00299881, 0x00dee0a0, 0x001b68c1, 0x001f48e1,
+    0x001f4901, 0x001f4921, 0x00432140, 0x000f7161, 0x000f7181, 0x001b09a1, 0x002d19c0, 0x001151e1,
+    0x001eea01, 0x002fc220, 0x00293a41, 0x00404260, 0x00dd0280, 0x001b6aa1, 0x001f4ac1, 0x001f4ae1,
+    0x001f4b01, 0x0043e320, 0x000f7341, 0x000f7361, 0x000f7381, 0x002da3a0, 0x000f73c1, 0x000f73e1,
+    0x00304c00, 0x001b0c21, 0x00304c40, 0x0040cc60, 0x000f7481, 0x000f74a1, 0x000f74c1, 0x001b64e0,
+    0x000f7501, 0x000f7521, 0x0017dd40, 0x001b0d61, 0x002a6d80, 0x002a6da0, 0x000ecdc1, 0x000ecde1,
+    0x00186e00, 0x0019ee21, 0x002a3e40, 0x002a3e60, 0x00283681, 0x003dc6a0, 0x003dc6c0, 0x00da86e0,
+    0x001b6f01, 0x001f4f21, 0x001f4f41, 0x001f4f61, 0x0043ff80, 0x000f77a1, 0x000f77c1, 0x000f77e1,
+    0x002db800, 0x000f7021, 0x000f7041, 0x0030a860, 0x00120081, 0x0030d8a0, 0x004158c0, 0x000f70e1,
+    0x000f7101, 0x000f7121, 0x001b7940, 0x000f7161, 0x000f7181, 0x001839a0, 0x000f71c1, 0x001869e0,
+    0x002afa00, 0x000e5221, 0x000e5241, 0x00180a60, 0x000e5281, 0x00183aa0, 0x002acac0, 0x001622e1,
+    0x0021a300, 0x002e0320, 0x003e8340, 0x000f7361, 0x000f7381, 0x000f73a1, 0x001b7bc0, 0x000f73e1,
+    0x000f7401, 0x00180c20, 0x000f7441, 0x00180c60, 0x001c8c80, 0x000e54a1, 0x000e54c1, 0x0017bce0,
+    0x000e5501, 0x0017bd20, 0x00181d40, 0x001a0561, 0x00278580, 0x0027b5a0, 0x0027b5c0, 0x000e55e1,
+    0x000e5601, 0x0017ce20, 0x000e5641, 0x0017ce60, 0x0017ce80, 0x001a06a1, 0x002766c0, 0x002766e0,
+    0x00276700, 0x0021d721, 0x0036c740, 0x0036c760, 0x0036c780, 0x00d74fa0, 0x000d37d1, 0x000eeff1,
+    0x000ee811, 0x000ee831, 0x002a3850, 0x00081071, 0x00081091, 0x000810b1, 0x001d68d0, 0x000810f1,
+    0x00081111, 0x00206930, 0x00093151, 0x00206970, 0x002ab990, 0x000811b1, 0x000811d1, 0x000811f1,
+    0x00128210, 0x00081231, 0x00081251, 0x0011aa70, 0x00081291, 0x0011aab0, 0x001d42d0, 0x000812f1,
+    0x00081311, 0x00125330, 0x00081351, 0x00125370, 0x001deb90, 0x0008e3b1, 0x00136bd0, 0x002103f0,
+    0x002b5410, 0x00081431, 0x00081451, 0x00081471, 0x00136490, 0x000814b1, 0x000814d1, 0x00128cf0,
+    0x00081511, 0x00128d30, 0x00151d50, 0x00081571, 0x00081591, 0x0012fdb0, 0x000815d1, 0x0012fdf0,
+    0x0012fe10, 0x00081631, 0x00123e50, 0x00123e70, 0x001dd690, 0x000816b1, 0x000816d1, 0x00133ef0,
+    0x00081711, 0x00133f30, 0x00133f50, 0x00081771, 0x00127f90, 0x00127fb0, 0x001e17d0, 0x000b87f1,
+    0x001a6010, 0x001a6030, 0x001e4050, 0x002bc070, 0x00081091, 0x000810b1, 0x000810d1, 0x0013d0f0,
+    0x00081111, 0x00081131, 0x0012f950, 0x00081171, 0x0012f990, 0x001589b0, 0x000811d1, 0x000811f1,
+    0x00136a10, 0x00081231, 0x00136a50, 0x00136a70, 0x00081291, 0x0012aab0, 0x0012aad0, 0x00153af0,
+    0x00081311, 0x00081331, 0x0013ab50, 0x00081371, 0x0013ab90, 0x0013abb0, 0x000813d1, 0x0012ebf0,
+    0x0012ec10, 0x0012ec30, 0x000b8451, 0x001ad470, 0x001ad490, 0x001ad4b0, 0x001a2cd0, 0x000814f1,
+    0x00081511, 0x00140530, 0x00081551, 0x00140570, 0x00140590, 0x000815b1, 0x001345d0, 0x001345f0,
+    0x00134610, 0x000d3e31, 0x001eee50, 0x001eee70, 0x001eee90, 0x001e46b0, 0x0011ced1, 0x00294ef0,
+    0x00294f10, 0x00294f30, 0x0028a750, 0x008e7f70, 0x000cff91, 0x000eb7b1, 0x000eb7d1, 0x000eb7f1,
+    0x002b7010, 0x0007d831, 0x0007d851, 0x0007d871, 0x001d4890, 0x0007d8b1, 0x0007d8d1, 0x002048f0,
+    0x0008f911, 0x00204930, 0x002a9950, 0x0007d971, 0x0007d991, 0x0007d9b1, 0x0012b1d0, 0x0007d9f1,
+    0x0007da11, 0x0011da30, 0x0007da51, 0x0011da70, 0x001d7290, 0x0007dab1, 0x0007dad1, 0x0011daf0,
+    0x0007db11, 0x0011db30, 0x001d7350, 0x0008ab71, 0x0012f390, 0x00208bb0, 0x002adbd0, 0x0007dbf1,
+    0x0007dc11, 0x0007dc31, 0x00139450, 0x0007dc71, 0x0007dc91, 0x0012bcb0, 0x0007dcd1, 0x0012bcf0,
+    0x00154d10, 0x0007dd31, 0x0007dd51, 0x0012bd70, 0x0007dd91, 0x0012bdb0, 0x0012bdd0, 0x0007ddf1,
+    0x0011fe10, 0x0011fe30, 0x001d9650, 0x0007de71, 0x0007de91, 0x00130eb0, 0x0007ded1, 0x00130ef0,
+    0x00130f10, 0x0007df31, 0x00124f50, 0x00124f70, 0x001de790, 0x00080fb1, 0x0012bfd0, 0x0012bff0,
+    0x001de010, 0x002b6030, 0x0007d851, 0x0007d871, 0x0007d891, 0x001428b0, 0x0007d8d1, 0x0007d8f1,
+    0x00135110, 0x0007d931, 0x00135150, 0x0015e170, 0x0007d991, 0x0007d9b1, 0x001351d0, 0x0007d9f1,
+    0x00135210, 0x00135230, 0x0007da51, 0x00129270, 0x00129290, 0x001522b0, 0x0007dad1, 0x0007daf1,
+    0x0013a310, 0x0007db31, 0x0013a350, 0x0013a370, 0x0007db91, 0x0012e3b0, 0x0012e3d0, 0x0012e3f0,
+    0x0007dc11, 0x0012e430, 0x0012e450, 0x0012e470, 0x0019f490, 0x0007dcb1, 0x0007dcd1, 0x0013dcf0,
+    0x0007dd11, 0x0013dd30, 0x0013dd50, 0x0007dd71, 0x00131d90, 0x00131db0, 0x00131dd0, 0x0007ddf1,
+    0x00131e10, 0x00131e30, 0x00131e50, 0x001e0e70, 0x000b4e91, 0x001ae6b0, 0x001ae6d0, 0x001ae6f0,
+    0x001e1f10, 0x00286f30, 0x0007db98, 0x0007e3f8, 0x0007e438, 0x0007e458, 0x000b7db8, 0x000b7dd8,
+    0x000b7df8, 0x000b6618, 0x000b6638, 0x00083e98, 0x00083ed8, 0x00083ef8, 0x00082738, 0x00082758,
+    0x00082778, 0x000827b8, 0x000827d8, 0x000827f8, 0x00080818, 0x000bd058, 0x000bd078, 0x000bd098,
+    0x000bb8b8, 0x000bb8d8, 0x00126918, 0x00126938, 0x00126958, 0x00125178, 0x00125198, 0x003fa9b8,
+    0x000cf9d1, 0x000eb1f1, 0x000eb211, 0x000eb231, 0x002d6250, 0x0007da71, 0x0007da91, 0x0007dab1,
+    0x001f3ad0, 0x0007daf1, 0x0007db11, 0x00223b30, 0x0008fb51, 0x00223b70, 0x002c8b90, 0x0007dbb1,
+    0x0007dbd1, 0x0007dbf1, 0x0013a410, 0x0007dc31, 0x0007dc51, 0x0012cc70, 0x0007dc91, 0x0012ccb0,
+    0x001e64d0, 0x0007dcf1, 0x0007dd11, 0x0012cd30, 0x0007dd51, 0x0012cd70, 0x001e6590, 0x0008adb1,
+    0x0013e5d0, 0x00217df0, 0x002bce10, 0x0007de31, 0x0007de51, 0x0007de71, 0x00143690, 0x0007deb1,
+    0x0007ded1, 0x00135ef0, 0x0007df11, 0x00135f30, 0x0015ef50, 0x0007df71, 0x0007df91, 0x00135fb0,
+    0x0007dfd1, 0x00135ff0, 0x00135810, 0x0007d831, 0x00129850, 0x00129870, 0x001e3090, 0x0007d8b1,
+    0x0007d8d1, 0x001358f0, 0x0007d911, 0x00135930, 0x00135950, 0x0007d971, 0x00129990, 0x001299b0,
+    0x001e31d0, 0x000809f1, 0x00130a10, 0x00130a30, 0x001e3250, 0x002bb270, 0x0007da91, 0x0007dab1,
+    0x0007dad1, 0x0014caf0, 0x0007db11, 0x0007db31, 0x0013f350, 0x0007db71, 0x0013f390, 0x001683b0,
+    0x0007dbd1, 0x0007dbf1, 0x0013f410, 0x0007dc31, 0x0013f450, 0x0013f470, 0x0007dc91, 0x001334b0,
+    0x001334d0, 0x0015c4f0, 0x0007dd11, 0x0007dd31, 0x0013f550, 0x0007dd71, 0x0013f590, 0x0013f5b0,
+    0x0007ddd1, 0x001335f0, 0x00133610, 0x00133630, 0x0007de51, 0x00133670, 0x00133690, 0x001336b0,
+    0x001a46d0, 0x0007def1, 0x0007df11, 0x0013ff30, 0x0007df51, 0x0013ff70, 0x0013ff90, 0x0007dfb1,
+    0x00133fd0, 0x00133ff0, 0x00133810, 0x0007d831, 0x00133850, 0x00133870, 0x00133890, 0x001e28b0,
+    0x0007d8d1, 0x001338f0, 0x00133910, 0x00133930, 0x001e2950, 0x00287970, 0x0007f1f8, 0x0007da58,
+    0x0007da98, 0x0008fab8, 0x0007db18, 0x0007db58, 0x0007db78, 0x0008e3f8, 0x0007dc58, 0x0007dc98,
+    0x0007dcb8, 0x00087dd8, 0x00086638, 0x00086678, 0x00086698, 0x00084ed8, 0x00084ef8, 0x00084f18,
+    0x00084f58, 0x00084f78, 0x00084f98, 0x000837b8, 0x00084ff8, 0x00084818, 0x00084838, 0x00083058,
+    0x000b9878, 0x0008b8d8, 0x0008b918, 0x0008b938, 0x0008a178, 0x0008a198, 0x0008a1b8, 0x0008a1f8,
+    0x0008a218, 0x0008a238, 0x00088a58, 0x0008a298, 0x0008a2b8, 0x0008a2d8, 0x00088af8, 0x000bf318,
+    0x000a8b58, 0x000a8b78, 0x000a8b98, 0x000a73b8, 0x000ddbd8, 0x001273f8, 0x0008a538, 0x00088e78,
+    0x00082058, 0x000820b8, 0x000820f8, 0x00082118, 0x00080958, 0x00080978, 0x00080998, 0x000809d8,
+    0x000809f8, 0x00080a18, 0x0007f238, 0x00080a78, 0x00080a98, 0x00080ab8, 0x0007f2d8, 0x000822f8,
+    0x00089358, 0x00089398, 0x000893b8, 0x00087bf8, 0x00087c18, 0x00087c38, 0x00087c78, 0x00087c98,
+    0x00087cb8, 0x000864d8, 0x00087d18, 0x00087d38, 0x00087d58, 0x00086578, 0x00086598, 0x000c1dd8,
+    0x000c1df8, 0x000c1e18, 0x000c0638, 0x000c0658, 0x000c0678, 0x00129afc, 0x000cfb11, 0x000eb331,
+    0x000eb351, 0x000eb371, 0x002e7390, 0x0007dbb1, 0x0007dbd1, 0x0007dbf1, 0x00204c10, 0x0007dc31,
+    0x0007dc51, 0x00234c70, 0x0008fc91, 0x00234cb0, 0x002d9cd0, 0x0007dcf1, 0x0007dd11, 0x0007dd31,
+    0x0014b550, 0x0007dd71, 0x0007dd91, 0x0013ddb0, 0x0007ddd1, 0x0013ddf0, 0x001f7610, 0x0007de31,
+    0x0007de51, 0x0013de70, 0x0007de91, 0x0013deb0, 0x001f76d0, 0x0008aef1, 0x0014f710, 0x00228f30,
+    0x002cdf50, 0x0007df71, 0x0007df91, 0x0007dfb1, 0x00145fd0, 0x0007dff1, 0x0007d811, 0x00138030,
+    0x0007d851, 0x00138070, 0x00161090, 0x0007d8b1, 0x0007d8d1, 0x001380f0, 0x0007d911, 0x00138130,
+    0x00138150, 0x0007d971, 0x0012c190, 0x0012c1b0, 0x001e59d0, 0x0007d9f1, 0x0007da11, 0x00138230,
+    0x0007da51, 0x00138270, 0x00138290, 0x0007dab1, 0x0012c2d0, 0x0012c2f0, 0x001e5b10, 0x00080b31,
+    0x00133350, 0x00133370, 0x001e5b90, 0x002bdbb0, 0x0007dbd1, 0x0007dbf1, 0x0007dc11, 0x00151c30,
+    0x0007dc51, 0x0007dc71, 0x00144490, 0x0007dcb1, 0x001444d0, 0x0016d4f0, 0x0007dd11, 0x0007dd31,
+    0x00144550, 0x0007dd71, 0x00144590, 0x001445b0, 0x0007ddd1, 0x001385f0, 0x00138610, 0x00161630,
+    0x0007de51, 0x0007de71, 0x00144690, 0x0007deb1, 0x001446d0, 0x001446f0, 0x0007df11, 0x00138730,
+    0x00138750, 0x00138770, 0x0007df91, 0x001387b0, 0x001387d0, 0x001387f0, 0x001a9010, 0x0007d831,
+    0x0007d851, 0x0013f870, 0x0007d891, 0x0013f8b0, 0x0013f8d0, 0x0007d8f1, 0x00133910, 0x00133930,
+    0x00133950, 0x0007d971, 0x00133990, 0x001339b0, 0x001339d0, 0x001e29f0, 0x0007da11, 0x00133a30,
+    0x00133a50, 0x00133a70, 0x001e2a90, 0x00287ab0, 0x0008b338, 0x00089b98, 0x00089bd8, 0x0009bbf8,
+    0x00089c58, 0x00089c98, 0x00089cb8, 0x000884f8, 0x00088518, 0x0009a538, 0x00089d98, 0x00089dd8,
+    0x00089df8, 0x00088638, 0x00088658, 0x00088678, 0x000886b8, 0x000886d8, 0x000886f8, 0x00093f18,
+    0x00088f78, 0x00088fb8, 0x00088fd8, 0x00087018, 0x00087038, 0x00087058, 0x00087098, 0x000870b8,
+    0x000870d8, 0x000858f8, 0x00087138, 0x00087158, 0x00087178, 0x00085998, 0x000bc1b8, 0x0008fa18,
+    0x0008fa58, 0x0008fa78, 0x0008e2b8, 0x0008e2d8, 0x0008e2f8, 0x0008e338, 0x0008e358, 0x0008e378,
+    0x0008cb98, 0x0008e3d8, 0x0008e3f8, 0x0008e418, 0x0008cc38, 0x000c3458, 0x0008d498, 0x0008d4b8,
+    0x0008d4d8, 0x0008bcf8, 0x000ddd18, 0x00127538, 0x000865b8, 0x00084e18, 0x00084e58, 0x00096e78,
+    0x00084ed8, 0x00084f18, 0x00084f38, 0x00083778, 0x00083798, 0x000957b8, 0x00084818, 0x00084858,
+    0x00084878, 0x000830b8, 0x000830d8, 0x000830f8, 0x00083138, 0x00083158, 0x00083178, 0x0008e998,
+    0x000839f8, 0x00083a38, 0x00083a58, 0x00082298, 0x000822b8, 0x000822d8, 0x00082318, 0x00082338,
+    0x00082358, 0x00080b78, 0x000823b8, 0x000823d8, 0x000823f8, 0x00080c18, 0x00083c38, 0x0008d498,
+    0x0008d4d8, 0x0008d4f8, 0x0008bd38, 0x0008bd58, 0x0008bd78, 0x0008bdb8, 0x0008bdd8, 0x0008bdf8,
+    0x0008a618, 0x0008be58, 0x0008be78, 0x0008be98, 0x0008a6b8, 0x0008a6d8, 0x0008af18, 0x0008af38,
+    0x0008af58, 0x00089778, 0x00089798, 0x000bffb8, 0x000864b8, 0x00084d18, 0x00084d58, 0x00096d78,
+    0x00084dd8, 0x00084e18, 0x00084e38, 0x00083678, 0x00083698, 0x000956b8, 0x00084f18, 0x00084f58,
+    0x00084f78, 0x000837b8, 0x000837d8, 0x000837f8, 0x00083038, 0x00083058, 0x00083078, 0x0008e898,
+    0x000838f8, 0x00083938, 0x00083958, 0x00082198, 0x000821b8, 0x000821d8, 0x00082218, 0x00082238,
+    0x00082258, 0x00080a78, 0x000822b8, 0x000822d8, 0x000822f8, 0x00080b18, 0x00083b38, 0x0008d398,
+    0x0008d3d8, 0x0008d3f8, 0x0008bc38, 0x0008bc58, 0x0008bc78, 0x0008bcb8, 0x0008bcd8, 0x0008bcf8,
+    0x0008a518, 0x0008bd58, 0x0008bd78, 0x0008bd98, 0x0008a5b8, 0x0008a5d8, 0x0008ae18, 0x0008ae38,
+    0x0008ae58, 0x00089678, 0x00089698, 0x000896b8, 0x002028e1, 0x00217901, 0x00217921, 0x00217941,
+    0x003e7160, 0x000bf181, 0x000bf1a1, 0x000ff1c1, 0x002f49e0, 0x000bf201, 0x000ff221, 0x00320240,
+    0x0013ea61, 0x00323280, 0x0040a2a0, 0x000bf2c1, 0x000bf2e1, 0x000bf301, 0x00169b20, 0x000bf341,
+    0x000bf361, 0x00174380, 0x000ff3a1, 0x001773c0, 0x003123e0, 0x0009c401, 0x000b4c21, 0x00115c40,
+    0x000f4c61, 0x0017ec80, 0x00319ca0, 0x001294c1, 0x001d5ce0, 0x0033dd00, 0x00424d20, 0x000bf541,
+    0x000bf561, 0x000bf581, 0x001775a0, 0x000bf5c1, 0x000bf5e1, 0x00180600, 0x000bf621, 0x00180640,
+    0x001e9660, 0x00096e81, 0x00096ea1, 0x0011e6c0, 0x000b4ee1, 0x0011e700, 0x00187720, 0x000f4f41,
+    0x00187760, 0x0018a780, 0x003257a0, 0x0009c7c1, 0x0009c7e1, 0x000fc000, 0x000b4821, 0x00123040,
+    0x00123060, 0x000f4881, 0x0018c0a0, 0x0018c0c0, 0x003270e0, 0x0010e901, 0x001d8920, 0x001d8940,
+    0x0031f960, 0x00427980, 0x000bf1a1, 0x000bf1c1, 0x000bf1e1, 0x00181a00, 0x000bf221, 0x000bf241,
+    0x00181a60, 0x000bf281, 0x0018c2a0, 0x001f52c0, 0x00096ae1, 0x00096b01, 0x0011fb20, 0x00096b41,
+    0x0012a360, 0x00193380, 0x000a9ba1, 0x0012a3c0, 0x001933e0, 0x001fc400, 0x00096c21, 0x00096c41,
+    0x000f4c60, 0x00096c81, 0x000ff4a0, 0x0012f4c0, 0x000a9ce1, 0x0011d500, 0x0012f520, 0x00198540,
+    0x000c3d61, 0x00169d80, 0x00169da0, 0x00190dc0, 0x002c8de0, 0x00096e01, 0x00096e21, 0x000f4e40,
+    0x00096e61, 0x000f4e80, 0x000ff6a0, 0x000b4ec1, 0x00124ee0, 0x0012f700, 0x0012f720, 0x000da741,
+    0x00181760, 0x0018bf80, 0x0018bfa0, 0x00326fc0, 0x0010efe1, 0x001d6000, 0x001d6020, 0x001d6040,
+    0x0031d060, 0x0040a880, 0x000c0108, 0x000c0168, 0x000c01a8, 0x001001c8, 0x00096228, 0x00096268,
+    0x000d5a88, 0x000962c8, 0x000d5ae8, 0x00115b08, 0x00083368, 0x000833a8, 0x000a13c8, 0x00083408,
+    0x000a1428, 0x000e0c48, 0x0008dc88, 0x000abca8, 0x000eb4c8, 0x0011fce8, 0x00091548, 0x00091588,
+    0x000915a8, 0x000915e8, 0x00091608, 0x000af628, 0x000ab668, 0x000ab688, 0x000b66a8, 0x000f5ec8,
+    0x000e3f08, 0x000e3f28, 0x000e3f48, 0x000f9f68, 0x001c0788, 0x000987e8, 0x00098028, 0x00098048,
+    0x00098088, 0x000980a8, 0x000ac0c8, 0x000b2108, 0x000b2128, 0x000b2148, 0x000b2168, 0x000ea9a8,
+    0x000ea9c8, 0x000ea9e8, 0x000eaa08, 0x001c7228, 0x0012fa68, 0x0012fa88, 0x0012faa8, 0x0012fac8,
+    0x002082e8, 0x002ae308, 0x000d3b88, 0x000d3be8, 0x000d3c28, 0x00113c48, 0x000944a8, 0x000944e8,
+    0x000d3d08, 0x00094548, 0x000d3d68, 0x00113d88, 0x000865e8, 0x00086628, 0x000a4648, 0x00086688,
+    0x000a46a8, 0x000e3ec8, 0x0008bf08, 0x000a4728, 0x000e3f48, 0x00118768, 0x000947c8, 0x00094008,
+    0x00094028, 0x00094068, 0x00094088, 0x000b20a8, 0x000940e8, 0x00094108, 0x000b2128, 0x000f1948,
+    0x00099188, 0x000991a8, 0x000b71c8, 0x000f69e8, 0x0012b208, 0x0009da68, 0x0009daa8, 0x0009dac8,
+    0x0009db08, 0x0009db28, 0x000b1b48, 0x0009db88, 0x0009dba8, 0x0009dbc8, 0x000b03e8, 0x000a2c28,
+    0x000a2c48, 0x000a2c68, 0x000b5488, 0x000e9ca8, 0x000edce8, 0x000edd08, 0x000edd28, 0x000edd48,
+    0x00103d68, 0x001c8588, 0x000b210c, 0x000b79ec, 0x00121a0c, 0x000f2a88, 0x000f2ae8, 0x000f2b28,
+    0x00132b48, 0x000b33a8, 0x000b33e8, 0x000f2c08, 0x000b3448, 0x000f2c68, 0x00132c88, 0x000954e8,
+    0x00095528, 0x000b3548, 0x00095588, 0x000b35a8, 0x000f2dc8, 0x0009ae08, 0x000b3628, 0x000f2e48,
+    0x00127668, 0x0009e6c8, 0x0009e708, 0x0009e728, 0x0009e768, 0x0009e788, 0x000bc7a8, 0x0009e7e8,
+    0x0009e008, 0x000bc028, 0x000fb848, 0x000a3888, 0x000a38a8, 0x000bc0c8, 0x000fb8e8, 0x00130108,
+    0x000a7968, 0x000a79a8, 0x000a79c8, 0x000a7a08, 0x000a7a28, 0x000bba48, 0x000a7a88, 0x000a7aa8,
+    0x000a7ac8, 0x000ba2e8, 0x000a7b28, 0x000a7b48, 0x000a7b68, 0x000ba388, 0x000eeba8, 0x000a83e8,
+    0x000a8408, 0x000a8428, 0x000c6448, 0x00105c68, 0x0013a488, 0x000a310c, 0x000bc58c, 0x00103f28,
+    0x00103f88, 0x00103fc8, 0x00143fe8, 0x000c4048, 0x000c4088, 0x001038a8, 0x000c40e8, 0x00103908,
+    0x00143928, 0x000a6188, 0x000a61c8, 0x000c41e8, 0x000a6228, 0x000c4248, 0x00103a68, 0x000abaa8,
+    0x000c42c8, 0x00103ae8, 0x00138308, 0x000a0b68, 0x000a0ba8, 0x000a0bc8, 0x000a0c08, 0x000a0c28,
+    0x000bec48, 0x000a0c88, 0x000a0ca8, 0x000becc8, 0x000fe4e8, 0x000a6528, 0x000a6548, 0x000bed68,
+    0x000fe588, 0x00132da8, 0x000ace08, 0x000ace48, 0x000ace68, 0x000acea8, 0x000acec8, 0x000c0ee8,
+    0x000acf28, 0x000acf48, 0x000acf68, 0x000bf788, 0x000acfc8, 0x000acfe8, 0x000ac808, 0x000bf028,
+    0x000f3848, 0x000a8088, 0x000a80a8, 0x000a80c8, 0x000c60e8, 0x00105908, 0x0013a128, 0x00217a41,
+    0x00217a61, 0x00217a81, 0x00217aa1, 0x00440ac0, 0x000b42e1, 0x000b4301, 0x000e8b21, 0x00369b40,
+    0x000bf361, 0x000ff381, 0x003543a0, 0x00133bc1, 0x003553e0, 0x0043c400, 0x000b4421, 0x000b4441,
+    0x000b4461, 0x00199c80, 0x000bf4a1, 0x000bf4c1, 0x001a84e0, 0x000e8d01, 0x001a9520, 0x00365540,
+    0x00096d61, 0x000a9d81, 0x001325a0, 0x000de5c1, 0x001875e0, 0x00367600, 0x0012ae21, 0x001e9640,
+    0x00351660, 0x00438680, 0x000b46a1, 0x000b46c1, 0x000b46e1, 0x001a8700, 0x000bf721, 0x000bf741,
+    0x001b4f60, 0x000bf781, 0x001b4fa0, 0x0020bfc0, 0x00096fe1, 0x00096801, 0x0013e820, 0x00096841,
+    0x0013e860, 0x00195880, 0x000df8a1, 0x0017e8c0, 0x001a38e0, 0x0035f900, 0x00096921, 0x00096941,
+    0x00125960, 0x00096981, 0x001259a0, 0x001259c0, 0x000df9e1, 0x00181a00, 0x00181a20, 0x00361a40,
+    0x000f9a61, 0x001cc280, 0x001cc2a0, 0x003582c0, 0x0042f2e0, 0x000b4301, 0x000b4321, 0x000b4341,
+    0x001a6b60, 0x000bf381, 0x000bf3a1, 0x001b6bc0, 0x000bf3e1, 0x001bbc00, 0x00212c20, 0x00096c41,
+    0x00096c61, 0x00140c80, 0x00096ca1, 0x00145cc0, 0x0019cce0, 0x00098501, 0x00146d20, 0x001add40,
+    0x00202d60, 0x00096d81, 0x00096da1, 0x00127dc0, 0x00096de1, 0x0012ce00, 0x0012ce20, 0x00098641,
+    0x00119e60, 0x00137e80, 0x0018cea0, 0x000a36c1, 0x0014c6e0, 0x0014c700, 0x00183720, 0x002d0740,
+    0x00096f61, 0x00096f81, 0x001277a0, 0x00096fc1, 0x001277e0, 0x00131800, 0x00098021, 0x00115840,
+    0x0011c860, 0x0011c880, 0x000a30a1, 0x001480c0, 0x0014f0e0, 0x0014f100, 0x00358120, 0x000d7941,
+    0x00199960, 0x00199980, 0x001999a0, 0x0034e1c0, 0x003b61e0, 0x000d8a68, 0x000e6ac8, 0x000e6b08,
+    0x0011b328, 0x000abb88, 0x000abbc8, 0x000e03e8, 0x000afc28, 0x000ef448, 0x00123c68, 0x000a44c8,
+    0x000a4508, 0x000a4528, 0x0009cd68, 0x000af588, 0x000e3da8, 0x000a1de8, 0x000b4608, 0x000e8e28,
+    0x0012d648, 0x000adea8, 0x000adee8, 0x000adf08, 0x000a6748, 0x000a6768, 0x000a6788, 0x000ab7c8,
+    0x000ab7e8, 0x000ab008, 0x000eb828, 0x000d4868, 0x000d4888, 0x000d48a8, 0x000ef8c8, 0x001ca8e8,
+    0x000b4948, 0x000b4988, 0x000b49a8, 0x000ad1e8, 0x000ad208, 0x000b2a28, 0x000b2268, 0x000b2288,
+    0x000b22a8, 0x000b92c8, 0x000dbb08, 0x000dbb28, 0x000dbb48, 0x000d5368, 0x001d1b88, 0x001093c8,
+    0x001093e8, 0x00109408, 0x00102c28, 0x00228448, 0x0027bc68, 0x000e14e8, 0x000ef548, 0x000ef588,
+    0x00123da8, 0x000a4608, 0x000a4648, 0x000d8e68, 0x000a86a8, 0x000e7ec8, 0x0011c6e8, 0x000a1f48,
+    0x000a1f88, 0x000a1fa8, 0x0009a7e8, 0x000ac808, 0x000e1028, 0x0009a068, 0x000ac888, 0x000e10a8,
+    0x001258c8, 0x000ac928, 0x000ac968, 0x000ac988, 0x000a51c8, 0x000a51e8, 0x000a5208, 0x000a5248,
+    0x000a5268, 0x000a5288, 0x000e5aa8, 0x000aa2e8, 0x000aa308, 0x000aa328, 0x000eab48, 0x0011f368,
+    0x000b63c8, 0x000b6408, 0x000b6428, 0x000aec68, 0x000aec88, 0x000b44a8, 0x000afce8, 0x000aed08,
+    0x000aed28, 0x000b7d48, 0x000b5d88, 0x000b5da8, 0x000b65c8, 0x000c55e8, 0x000d2e08, 0x000dd648,
+    0x000dd668, 0x000dd688, 0x000d6ea8, 0x000e2ec8, 0x001d36e8, 0x000b826c, 0x000bdb4c, 0x0010a36c,
+    0x000f2be8, 0x00100c48, 0x00100c88, 0x001354a8, 0x000b5d08, 0x000b5d48, 0x000ea568, 0x000b9da8,
+    0x000f95c8, 0x0012dde8, 0x000a3648, 0x000a3688, 0x000a36a8, 0x0009bee8, 0x000ae708, 0x000e2f28,
+    0x0009bf68, 0x000ae788, 0x000e2fa8, 0x001277c8, 0x000b1828, 0x000b1868, 0x000b1888, 0x000aa0c8,
+    0x000aa0e8, 0x000aa108, 0x000aa148, 0x000aa168, 0x000aa188, 0x000ea9a8, 0x000aa1e8, 0x000aa208,
+    0x000aa228, 0x000eaa48, 0x0011f268, 0x000bb2c8, 0x000bb308, 0x000bb328, 0x000b4368, 0x000b3b88,
+    0x000b93a8, 0x000b9be8, 0x000b3c08, 0x000b3c28, 0x000c1c48, 0x000bac88, 0x000baca8, 0x000b64c8,
+    0x000ca4e8, 0x000d5d08, 0x000ced48, 0x000cad68, 0x000cad88, 0x000d75a8, 0x000e4dc8, 0x0010c5e8,
+    0x000a626c, 0x000bf6ec, 0x00103888, 0x001118e8, 0x00111928, 0x00146148, 0x000c69a8, 0x000c69e8,
+    0x000fb208, 0x000caa48, 0x0010a268, 0x0013ea88, 0x000b42e8, 0x000b4328, 0x000b4348, 0x000acb88,
+    0x000bf3a8, 0x000f3bc8, 0x000acc08, 0x000bf428, 0x000f3c48, 0x00138468, 0x000b44c8, 0x000b4508,
+    0x000b4528, 0x000acd68, 0x000acd88, 0x000acda8, 0x000acde8, 0x000ace08, 0x000ace28, 0x000ed648,
+    0x000ace88, 0x000acea8, 0x000acec8, 0x000ed6e8, 0x00121f08, 0x000c0768, 0x000c07a8, 0x000c07c8,
+    0x000b9008, 0x000b8828, 0x000be048, 0x000be888, 0x000b88a8, 0x000b88c8, 0x000c68e8, 0x000bf928,
+    0x000bf948, 0x000bb168, 0x000cf188, 0x000da9a8, 0x000ce9e8, 0x000caa08, 0x000caa28, 0x000d7248,
+    0x000e4a68, 0x0010c288, 0x001f43a1, 0x001f43c1, 0x001f43e1, 0x002f3c00, 0x001f4421, 0x001f4441,
+    0x00303c60, 0x001f4481, 0x00308ca0, 0x00309cc0, 0x001644e1, 0x0016bd01, 0x00312d20, 0x0016bd41,
+    0x00317d60, 0x00318d80, 0x001645a1, 0x0031cdc0, 0x0031dde0, 0x0031ee00, 0x0017ae21, 0x0017ae41,
+    0x0025ce60, 0x0017ae81, 0x00261ea0, 0x00261ec0, 0x001646e1, 0x00266f00, 0x0032cf20, 0x0032df40,
+    0x0016af61, 0x00272f80, 0x0032cfa0, 0x0032dfc0, 0x0032efe0, 0x0017a801, 0x00189821, 0x00283040,
+    0x00189861, 0x00283080, 0x002880a0, 0x001640c1, 0x002700e0, 0x00281100, 0x00281120, 0x0016a941,
+    0x0027c160, 0x0028d180, 0x0028d1a0, 0x0033c1c0, 0x0016a9e1, 0x002a5200, 0x002a5220, 0x002a5240,
+    0x0033c260, 0x0032d280, 0x0017aaa1, 0x00189ac1, 0x0027f2e0, 0x00189b01, 0x0028f320, 0x00294340,
+    0x00164361, 0x00277380, 0x002883a0, 0x0028d3c0, 0x0016abe1, 0x00283400, 0x00294420, 0x00299440,
+    0x00255c60, 0x0016ac81, 0x002ac4a0, 0x002ac4c0, 0x002b14e0, 0x00260d00, 0x0025c520, 0x0016ad41,
+    0x002a1560, 0x002c9580, 0x002c95a0, 0x00267dc0, 0x00263de0, 0x00263600, 0x00096625, 0x0009d645,
+    0x0014de64, 0x0009d685, 0x0014dea4, 0x0014dec4, 0x0008c6e5, 0x0013ef04, 0x00146724, 0x00146744,
+    0x00096765, 0x00156784, 0x0015dfa4, 0x0015dfc4, 0x00133fe4, 0x00096005, 0x00177824, 0x00177844,
+    0x00177864, 0x00145884, 0x001510a4, 0x000960c5, 0x001810e4, 0x00190104, 0x00190124, 0x00153944,
+    0x0015f164, 0x0016c184, 0x000961a5, 0x001881c4, 0x001971e4, 0x00197204, 0x00166a24, 0x00172a44,
+    0x0017fa64, 0x0018ca84, 0x00092aa5, 0x00099ac5, 0x001562e4, 0x00099b05, 0x00156324, 0x00156344,
+    0x00088b65, 0x00147384, 0x0014eba4, 0x0014ebc4, 0x00092be5, 0x0014ec04, 0x00156424, 0x00156444,
+    0x0012c464, 0x00092c85, 0x001754a4, 0x001754c4, 0x001754e4, 0x00143504, 0x00149d24, 0x00092d45,
+    0x00180564, 0x0018f584, 0x0018f5a4, 0x00152dc4, 0x001595e4, 0x00167604, 0x00092e25, 0x00189e44,
+    0x00198e64, 0x00198e84, 0x001686a4, 0x0016f6c4, 0x0017d6e4, 0x0018a704, 0x00084766, 0x00084786,
+    0x00080fe6, 0x0008b806, 0x0009b826, 0x00092845, 0x00099865, 0x00167884, 0x000998a5, 0x001678c4,
+    0x001678e4, 0x00088905, 0x00158924, 0x00160144, 0x00160164, 0x00092985, 0x001601a4, 0x001679c4,
+    0x001679e4, 0x0013da04, 0x00092a25, 0x00176a44, 0x00176a64, 0x00176a84, 0x00144aa4, 0x0014b2c4,
+    0x00092ae5, 0x00185304, 0x00194324, 0x00194344, 0x00157b64, 0x0015e384, 0x001673a4, 0x00092bc5,
+    0x0018ebe4, 0x0019dc04, 0x0019dc24, 0x0016d444, 0x00174464, 0x0017d484, 0x0018b4a4, 0x00089ce6,
+    0x00090d06, 0x00090d26, 0x0007e566, 0x00082586, 0x0008fda6, 0x0009fdc6, 0x00084606, 0x0008b626,
+    0x0008b646, 0x0008bec6, 0x0009d6e6, 0x00092f25, 0x00099f45, 0x00178f64, 0x00099f85, 0x00178fa4,
+    0x00178fc4, 0x00088fe5, 0x00169804, 0x00171024, 0x00171044, 0x00092865, 0x00171084, 0x001788a4,
+    0x001788c4, 0x0014e8e4, 0x00092905, 0x00187924, 0x00187944, 0x00187964, 0x00155984, 0x0015c1a4,
+    0x000929c5, 0x001879e4, 0x00196a04, 0x00196a24, 0x0015a244, 0x00160a64, 0x00169a84, 0x00092aa5,
+    0x00193ac4, 0x001a2ae4, 0x001a2b04, 0x00172324, 0x00179344, 0x00182364, 0x0018b384, 0x00095bc6,
+    0x0009cbe6, 0x0009cc06, 0x00087426, 0x0008a446, 0x0008e466, 0x00092486, 0x000a3ca6, 0x00090ce6,
+    0x00097d06, 0x00097d26, 0x00082546, 0x00085566, 0x00089586, 0x0008d5a6, 0x000a15c6, 0x00090e26,
+    0x00097e46, 0x00097e66, 0x00082686, 0x000856a6, 0x000896c6, 0x0008d6e6, 0x000a1706, 0x0021c761,
+    0x0021c781, 0x0021c7a1, 0x0021c7c1, 0x0046b7e0, 0x000b8801, 0x000b8821, 0x000ed041, 0x00390060,
+    0x000c3881, 0x001038a1, 0x0037a8c0, 0x001380e1, 0x0037b900, 0x00462920, 0x000b8941, 0x000b8961,
+    0x000b8981, 0x001b89a0, 0x000c39c1, 0x000c39e1, 0x001c7200, 0x000ed221, 0x001c8240, 0x00384260,
+    0x0009b281, 0x000ae2a1, 0x001512c0, 0x000e2ae1, 0x001a6300, 0x00386320, 0x00123b41, 0x001f6360,
+    0x00370380, 0x004573a0, 0x000b8bc1, 0x000b8be1, 0x000b8c01, 0x001c5420, 0x000c3c41, 0x000c3c61,
+    0x001d0480, 0x000c3ca1, 0x001d04c0, 0x002274e0, 0x0009b501, 0x0009b521, 0x00157d40, 0x0009b561,
+    0x00157d80, 0x001aeda0, 0x000e45c1, 0x00197de0, 0x001bce00, 0x00378e20, 0x0009b641, 0x0009b661,
+    0x0013b680, 0x0009b6a1, 0x0013b6c0, 0x0013b6e0, 0x000e4701, 0x00197720, 0x00197740, 0x00377760,
+    0x000f2f81, 0x001cffa0, 0x001cffc0, 0x0036dfe0, 0x00444800, 0x000b8821, 0x000b8841, 0x000b8861,
+    0x001be880, 0x000c38a1, 0x000c38c1, 0x001ce8e0, 0x000c3901, 0x001d3920, 0x0022a940, 0x0009b161,
+    0x0009b181, 0x001561a0, 0x0009b1c1, 0x0015b1e0, 0x001b2200, 0x0009ca21, 0x0015c240, 0x001c3260,
+    0x00218280, 0x0009b2a1, 0x0009b2c1, 0x00139ae0, 0x0009b301, 0x0013eb20, 0x0013eb40, 0x0009cb61,
+    0x0012bb80, 0x00149ba0, 0x0019ebc0, 0x000913e1, 0x0013a400, 0x00140420, 0x00195440, 0x00366460,
+    0x0009b481, 0x0009b4a1, 0x001354c0, 0x0009b4e1, 0x00135500, 0x0013fd20, 0x0009cd41, 0x00123d60,
+    0x0012ad80, 0x0012ada0, 0x000a7dc1, 0x001555e0, 0x0015c600, 0x0015c620, 0x00365640, 0x000d1661,
+    0x00193e80, 0x00193ea0, 0x00193ec0, 0x0035a6e0, 0x003c2700, 0x000edf88, 0x000fbfe8, 0x000fb828,
+    0x00130048, 0x000bc8a8, 0x000bc8e8, 0x000f1108, 0x000c0948, 0x00100168, 0x00134988, 0x000b11e8,
+    0x000b1228, 0x000b1248, 0x000a9a88, 0x000bc2a8, 0x000f0ac8, 0x000aeb08, 0x000c1328, 0x000f5b48,
+    0x0012f368, 0x000bc3c8, 0x000bc408, 0x000bc428, 0x000b4c68, 0x000b4c88, 0x000b4ca8, 0x000b84e8,
+    0x000b7508, 0x000b7528, 0x000f7d48, 0x000c7d88, 0x000c7da8, 0x000c7dc8, 0x000f95e8, 0x00226e08,
+    0x000c3668, 0x000c36a8, 0x000c36c8, 0x000bcf08, 0x000bbf28, 0x000c1748, 0x000c6f88, 0x000c07a8,
+    0x000be7c8, 0x000cefe8, 0x000ce828, 0x000ce848, 0x000ce868, 0x000d7888, 0x0022d8a8, 0x001110e8,
+    0x00111108, 0x00111128, 0x0010a948, 0x0022f168, 0x00281988, 0x000fd208, 0x0010b268, 0x0010b2a8,
+    0x0013fac8, 0x000c0328, 0x000c0368, 0x000f4b88, 0x000c43c8, 0x00103be8, 0x00138408, 0x000b6468,
+    0x000b64a8, 0x000b64c8, 0x000aed08, 0x000c1528, 0x000f5d48, 0x000aed88, 0x000c15a8, 0x000f5dc8,
+    0x0012f5e8, 0x000bfe48, 0x000bfe88, 0x000bfea8, 0x000b86e8, 0x000b8708, 0x000b8728, 0x000b8768,
+    0x000b8788, 0x000b87a8, 0x000f8fc8, 0x000b9808, 0x000b9828, 0x000b9848, 0x000fa068, 0x00123888,
+    0x000c68e8, 0x000c6928, 0x000c6948, 0x000c2188, 0x000bf1a8, 0x000c49c8, 0x000c5208, 0x000bf228,
+    0x000bf248, 0x000cd268, 0x000c7aa8, 0x000c7ac8, 0x000c32e8, 0x000d7308, 0x000e2b28, 0x000dab68,
+    0x000d4388, 0x000d43a8, 0x000e33c8, 0x000efbe8, 0x0022f408, 0x000e378c, 0x000e886c, 0x0010f88c,
+    0x0010b908, 0x00119968, 0x001199a8, 0x0014e1c8, 0x000cea28, 0x000cea68, 0x00103288, 0x000d2ac8,
+    0x001122e8, 0x00146b08, 0x000bc368, 0x000bc3a8, 0x000bc3c8, 0x000b4c08, 0x000c7428, 0x000fbc48,
+    0x000b4c88, 0x000c74a8, 0x000fbcc8, 0x001354e8, 0x000c2d48, 0x000c2d88, 0x000c2da8, 0x000bb5e8,
+    0x000bb608, 0x000bb628, 0x000be668, 0x000bb688, 0x000bb6a8, 0x000fbec8, 0x000bbf08, 0x000bbf28,
+    0x000bbf48, 0x000fbf68, 0x00125788, 0x000c9fe8, 0x000c9828, 0x000c9848, 0x000cc088, 0x000c58a8,
+    0x000c78c8, 0x000cf108, 0x000c8928, 0x000c3148, 0x000d7168, 0x000cc9a8, 0x000cc9c8, 0x000c71e8,
+    0x000dc208, 0x000e7a28, 0x000dca68, 0x000d4288, 0x000d42a8, 0x000e52c8, 0x000f1ae8, 0x0010a308,
+    0x000aaf8c, 0x000eb40c, 0x001145a8, 0x00122608, 0x00122648, 0x00156e68, 0x000d76c8, 0x000d7708,
+    0x0010bf28, 0x000db768, 0x0011af88, 0x0014f7a8, 0x000c4808, 0x000c4848, 0x000c4868, 0x000bd0a8,
+    0x000cf8c8, 0x001040e8, 0x000be928, 0x000cf948, 0x00104168, 0x0013d988, 0x000c29e8, 0x000c2a28,
+    0x000c2a48, 0x000bda88, 0x000bb2a8, 0x000bb2c8, 0x000c0b08, 0x000bb328, 0x000bb348, 0x000fbb68,
+    0x000be3a8, 0x000be3c8, 0x000be3e8, 0x000fbc08, 0x00125428, 0x000cb488, 0x000cb4c8, 0x000cb4e8,
+    0x000d1528, 0x000cad48, 0x000c9568, 0x000d45a8, 0x000cddc8, 0x000c85e8, 0x000dc608, 0x000d1e48,
+    0x000d1e68, 0x000cc688, 0x000e16a8, 0x000ecec8, 0x000dcf08, 0x000d4728, 0x000d4748, 0x000e5768,
+    0x000f1f88, 0x0010a7a8, 0x001f88c1, 0x001f88e1, 0x001f8901, 0x0031f920, 0x001f8941, 0x001f8961,
+    0x0032e180, 0x001f89a1, 0x003331c0, 0x003341e0, 0x00168a01, 0x00170221, 0x00339240, 0x00170261,
+    0x0033e280, 0x0033f2a0, 0x00168ac1, 0x003432e0, 0x00344300, 0x00345320, 0x0017f341, 0x0017f361,
+    0x0027bb80, 0x0017f3a1, 0x00280bc0, 0x00280be0, 0x00168c01, 0x00285c20, 0x0034bc40, 0x0034cc60,
+    0x0016f481, 0x00291ca0, 0x0034bcc0, 0x0034cce0, 0x0034dd00, 0x0017f521, 0x0018e541, 0x002a0560,
+    0x0018e581, 0x002a05a0, 0x002a55c0, 0x00168de1, 0x0028be00, 0x0029ce20, 0x0029ce40, 0x0016f661,
+    0x00295680, 0x002a66a0, 0x002a66c0, 0x003556e0, 0x0016f701, 0x002baf20, 0x002baf40, 0x002baf60,
+    0x00351f80, 0x00342fa0, 0x0017f7c1, 0x0018e7e1, 0x00297000, 0x0018e021, 0x002a7040, 0x002ac060,
+    0x00168881, 0x0028f0a0, 0x002a00c0, 0x002a50e0, 0x0016f101, 0x00298920, 0x002a9940, 0x002ae960,
+    0x0026b180, 0x0016f1a1, 0x002be1c0, 0x002be1e0, 0x002c3200, 0x00272a20, 0x0026e240, 0x0016f261,
+    0x002af280, 0x002d72a0, 0x002d72c0, 0x00275ae0, 0x00270b00, 0x0026f320, 0x00096345, 0x0009d365,
+    0x00162b84, 0x0009d3a5, 0x00162bc4, 0x00162be4, 0x0008c405, 0x00153c24, 0x0015b444, 0x0015b464,
+    0x00096485, 0x001674a4, 0x0016ecc4, 0x0016ece4, 0x00144d04, 0x00096525, 0x00184d44, 0x00184d64,
+    0x00184d84, 0x00152da4, 0x0015e5c4, 0x000965e5, 0x0018fe04, 0x0019ee24, 0x0019ee44, 0x00162664,
+    0x0016b684, 0x00175ea4, 0x000966c5, 0x00196ee4, 0x001a5f04, 0x001a5f24, 0x00175744, 0x0017ef64,
+    0x00189784, 0x00194fa4, 0x000967c5, 0x0009d7e5, 0x00172004, 0x0009d025, 0x00172044, 0x00172064,
+    0x0008c085, 0x001630a4, 0x0016a8c4, 0x0016a8e4, 0x00096105, 0x0016a924, 0x00172144, 0x00172164,
+    0x00148184, 0x000961a5, 0x001899c4, 0x001899e4, 0x00189a04, 0x00157a24, 0x0015e244, 0x00096265,
+    0x00193284, 0x001a22a4, 0x001a22c4, 0x00165ae4, 0x0016c304, 0x00176b24, 0x00096345, 0x0019a364,
+    0x001a9384, 0x001a93a4, 0x00178bc4, 0x0017fbe4, 0x0018a404, 0x00194c24, 0x00088c66, 0x0008fc86,
+    0x0008fca6, 0x00088506, 0x00094526, 0x000a4546, 0x00096565, 0x0009d585, 0x00180da4, 0x0009d5c5,
+    0x00180de4, 0x00180e04, 0x0008c625, 0x00171e44, 0x00179664, 0x00179684, 0x000966a5, 0x001796c4,
+    0x00180ee4, 0x00180f04, 0x00156f24, 0x00096745, 0x0018ff64, 0x0018ff84, 0x0018ffa4, 0x0015dfc4,
+    0x001647e4, 0x00096005, 0x00196024, 0x001a5044, 0x001a5064, 0x00168884, 0x0016f0a4, 0x001780c4,
+    0x000960e5, 0x0019d104, 0x001ac124, 0x001ac144, 0x0017b964, 0x00182984, 0x0018b9a4, 0x001949c4,
+    0x00094206, 0x0009b226, 0x0009b246, 0x00085a66, 0x00088a86, 0x0008caa6, 0x000972c6, 0x000a72e6,
+    0x00094326, 0x0009b346, 0x0009b366, 0x00085b86, 0x00088ba6, 0x0008cbc6, 0x000973e6, 0x000a7406,
+    0x00096445, 0x0009d465, 0x00189484, 0x0009d4a5, 0x001894c4, 0x001894e4, 0x0008c505, 0x0017a524,
+    0x00181d44, 0x00181d64, 0x00096585, 0x00181da4, 0x001895c4, 0x001895e4, 0x0015f604, 0x00096625,
+    0x00198644, 0x00198664, 0x00198684, 0x001666a4, 0x0016cec4, 0x000966e5, 0x00196704, 0x001a5724,
+    0x001a5744, 0x00168f64, 0x0016f784, 0x001787a4, 0x000967c5, 0x0019efe4, 0x001ad804, 0x001ad824,
+    0x0017d044, 0x00184064, 0x0018d084, 0x001948a4, 0x0009b0e6, 0x000a2106, 0x000a2126, 0x0008c946,
+    0x0008f966, 0x00093986, 0x000971a6, 0x000a89c6, 0x0009b206, 0x000a2226, 0x000a2246, 0x0008ca66,
+    0x0008fa86, 0x00093aa6, 0x000972c6, 0x000a8ae6, 0x0009b346, 0x000a2366, 0x000a2386, 0x0008cba6,
+    0x0008fbc6, 0x00093be6, 0x00097406, 0x000a8c26, 0x001f8c81, 0x001f8ca1, 0x001f8cc1, 0x00356ce0,
+    0x001f8d01, 0x001f8d21, 0x00356540, 0x001f8d61, 0x00357d80, 0x00358da0, 0x00168dc1, 0x00177de1,
+    0x0035de00, 0x00186e21, 0x0035f640, 0x00360660, 0x0016a681, 0x00358ea0, 0x00358ec0, 0x00358ee0,
+    0x0017f701, 0x0017f721, 0x002a0740, 0x0018e761, 0x002b9f80, 0x00367fa0, 0x0016a7c1, 0x0029a7e0,
+    0x00360000, 0x00360020, 0x00170841, 0x002a2860, 0x0035c880, 0x0035c8a0, 0x003568c0, 0x0017f0e1,
+    0x00195901, 0x002c9120, 0x00195941, 0x002c9160, 0x002c2180, 0x0016a1a1, 0x0029f1c0, 0x002b99e0,
+    0x00367a00, 0x00170a21, 0x002a7a40, 0x002c2260, 0x00364280, 0x0035f2a0, 0x00170ac1, 0x002caae0,
+    0x002cab00, 0x00360b20, 0x0035c340, 0x0034ab60, 0x0017f381, 0x00195ba1, 0x002c33c0, 0x001ac3e1,
+    0x002efc00, 0x002e8c20, 0x0016a441, 0x002a4c60, 0x002bf480, 0x002d8ca0, 0x00170cc1, 0x002ad4e0,
+    0x002c7d00, 0x002e1520, 0x00367d40, 0x00170d61, 0x002d0580, 0x002d05a0, 0x002e9dc0, 0x00364de0,
+    0x00353600, 0x00170e21, 0x002c2640, 0x002f2660, 0x002f2680, 0x00362ea0, 0x003516c0, 0x003406e0,
+    0x00096705, 0x000a0725, 0x00180744, 0x000aa765, 0x00196f84, 0x0018f7a4, 0x0008c7c5, 0x001667e4,
+    0x00175004, 0x00184024, 0x00096045, 0x00176064, 0x00185084, 0x001940a4, 0x0017b8c4, 0x000960e5,
+    0x00193904, 0x00193924, 0x001a2944, 0x00187164, 0x0018f184, 0x000979a5, 0x0019a9c4, 0x001b11e4,
+    0x001b1204, 0x0019ea24, 0x001f7244, 0x001f8a64, 0x0009da85, 0x001a1aa4, 0x001b82c4, 0x001ceae4,
+    0x001aeb04, 0x001fe324, 0x001ffb44, 0x00201364, 0x00096385, 0x000a03a5, 0x00188bc4, 0x000aa3e5,
+    0x0019f404, 0x00197c24, 0x00090445, 0x0016ec64, 0x0017dc84, 0x0018cca4, 0x000964c5, 0x001764e4,
+    0x00185504, 0x00194524, 0x00180544, 0x00096565, 0x00195584, 0x001955a4, 0x001a45c4, 0x0018d5e4,
+    0x0018f604, 0x00099e25, 0x0019c644, 0x001b2e64, 0x001b2e84, 0x001a4ea4, 0x001a96c4, 0x001b1ee4,
+    0x0009ff05, 0x001a3724, 0x001b9f44, 0x001d0764, 0x001b4f84, 0x001b97a4, 0x001c1fc4, 0x002017e4,
+    0x0008f026, 0x00098846, 0x000a2866, 0x00098886, 0x0009b8a6, 0x000a58c6, 0x000c48e6, 0x000ca106,
+    0x00096125, 0x000a0145, 0x00191164, 0x000aa185, 0x001a79a4, 0x001a01c4, 0x000979e5, 0x0017ca04,
+    0x00186224, 0x00195244, 0x00096265, 0x0017ea84, 0x0018daa4, 0x0019cac4, 0x001992e4, 0x00098b05,
+    0x00195324, 0x00195344, 0x001a4364, 0x0019db84, 0x001a03a4, 0x0009d3c5, 0x0019dbe4, 0x001b4404,
+    0x001b4424, 0x001ae444, 0x001b2c64, 0x001b9c84, 0x000a34a5, 0x001a4cc4, 0x001bb4e4, 0x001d1d04,
+    0x001be524, 0x001c2d44, 0x001c9d64, 0x001d5584, 0x00099dc6, 0x0009fde6, 0x000a9e06, 0x000a3626,
+    0x000a6646, 0x000a9666, 0x000b5e86, 0x000c16a6, 0x0009dee6, 0x0009ff06, 0x000a9f26, 0x000a7746,
+    0x000a8766, 0x000ab786, 0x000b7fa6, 0x000c37c6, 0x00096005, 0x000a0025, 0x00199844, 0x000aa065,
+    0x001b0084, 0x001a88a4, 0x000978c5, 0x001850e4, 0x0018e904, 0x0019d924, 0x00096145, 0x00187164,
+    0x00196184, 0x001a51a4, 0x001a19c4, 0x000989e5, 0x0019da04, 0x0019da24, 0x001aca44, 0x001a6264,
+    0x001a8a84, 0x0009d2a5, 0x0019dac4, 0x001b42e4, 0x001b4304, 0x001ae324, 0x001b2b44, 0x001b9b64,
+    0x000a3385, 0x001a63a4, 0x001bcbc4, 0x001d33e4, 0x001bfc04, 0x001c4424, 0x001cb444, 0x001d5464,
+    0x000a0ca6, 0x000a6cc6, 0x000b0ce6, 0x000aa506, 0x000ad526, 0x000b0546, 0x000b5d66, 0x000c2d86,
+    0x000a4dc6, 0x000a6de6, 0x000b0e06, 0x000ae626, 0x000af646, 0x000b2666, 0x000b7e86, 0x000c4ea6,
+    0x000ac706, 0x000a9726, 0x000b0f46, 0x000b5f66, 0x000b6f86, 0x000b9fa6, 0x000bb7c6, 0x000c87e6,
+    0x004a6041, 0x004a6061, 0x0077a080, 0x004a60a1, 0x007828c0, 0x007840e0, 0x004a6101, 0x0078b120,
+    0x0078c940, 0x0078e160, 0x0049d981, 0x007921a0, 0x007939c0, 0x007951e0, 0x0053ea00, 0x0049da21,
+    0x0079aa40, 0x0079aa60, 0x0079c280, 0x00545aa0, 0x0053eac0, 0x0049dae1, 0x0079ab00, 0x007a3320,
+    0x007a3340, 0x0054cb60, 0x00545b80, 0x0053eba0, 0x0049dbc1, 0x0079abe0, 0x007a3400, 0x007abc20,
+    0x0056bc40, 0x00564c60, 0x0055dc80, 0x00556ca0, 0x001fe4c3, 0x00485ce2, 0x00485d02, 0x00485d22,
+    0x0031dd42, 0x00326562, 0x0032d582, 0x003345a2, 0x00351dc2, 0x001fe5e3, 0x0048e602, 0x0048e622,
+    0x0048e642, 0x00326662, 0x00326682, 0x0032eea2, 0x00335ec2, 0x003536e2, 0x00153703, 0x001fe723,
+    0x00496f42, 0x00496f62, 0x00496f82, 0x0032efa2, 0x0032efc2, 0x0032efe2, 0x00337002, 0x00354822,
+    0x0015a043, 0x0015a063, 0x001fe083, 0x0049f0a2, 0x0049f0c2, 0x0049f0e2, 0x00337102, 0x00337122,
+    0x00337142, 0x00337162, 0x00356182, 0x001611a3, 0x001611c3, 0x001611e3, 0x00220a01, 0x00220a21,
+    0x00220a41, 0x00220a61, 0x00474280, 0x000bd2a1, 0x000bd2c1, 0x000f1ae1, 0x00399300, 0x000c8321,
+    0x00108341, 0x00383b60, 0x0013cb81, 0x00384ba0, 0x0046bbc0, 0x000bd3e1, 0x000bd401, 0x000bd421,
+    0x001c1c40, 0x000c8461, 0x000c8481, 0x001d04a0, 0x000f1cc1, 0x001d14e0, 0x0038d500, 0x0009fd21,
+    0x000b2d41, 0x0015a560, 0x000e7581, 0x001af5a0, 0x0038f5c0, 0x001285e1, 0x001ff600, 0x00379620,
+    0x00460640, 0x000bd661, 0x000bd681, 0x000bd6a1, 0x001ccec0, 0x000c86e1, 0x000c8701, 0x001d7f20,
+    0x000c8741, 0x001d7f60, 0x0022ef80, 0x0009ffa1, 0x0009ffc1, 0x0015f7e0, 0x0009f801, 0x0015f020,
+    0x001b6040, 0x000e8861, 0x0019f080, 0x001c40a0, 0x003800c0, 0x0009f8e1, 0x0009f901, 0x00142920,
+    0x0009f941, 0x00142960, 0x00142980, 0x000e89a1, 0x0019e9c0, 0x0019e9e0, 0x0037ea00, 0x000f7221,
+    0x001d7240, 0x001d7260, 0x00375280, 0x0044c2a0, 0x000bd2c1, 0x000bd2e1, 0x000bd301, 0x001c3320,
+    0x000c8341, 0x000c8361, 0x001d3380, 0x000c83a1, 0x001d83c0, 0x0022f3e0, 0x0009fc01, 0x0009fc21,
+    0x0015ac40, 0x0009fc61, 0x0015fc80, 0x001b6ca0, 0x000a14c1, 0x00160ce0, 0x001c7d00, 0x0021cd20,
+    0x0009fd41, 0x0009fd61, 0x0013e580, 0x0009fda1, 0x001435c0, 0x001435e0, 0x000a1601, 0x00130620,
+    0x0014e640, 0x001a3660, 0x00095e81, 0x0013eea0, 0x00144ec0, 0x00199ee0, 0x0036af00, 0x0009ff21,
+    0x0009ff41, 0x00139f60, 0x0009ff81, 0x00139fa0, 0x001447c0, 0x000a17e1, 0x00128000, 0x0012f020,
+    0x0012f040, 0x000ac061, 0x00159880, 0x001608a0, 0x001608c0, 0x003698e0, 0x000d5901, 0x00198120,
+    0x00198140, 0x00198160, 0x0035e980, 0x003c69a0, 0x000f6a28, 0x00104a88, 0x00104ac8, 0x001392e8,
+    0x000c5b48, 0x000c5b88, 0x000fa3a8, 0x000c9be8, 0x00109408, 0x0013dc28, 0x000ba488, 0x000ba4c8,
+    0x000ba4e8, 0x000b2d28, 0x000c5548, 0x000f9d68, 0x000b7da8, 0x000ca5c8, 0x000fede8, 0x00138608,
+    0x000c3e68, 0x000c3ea8, 0x000c3ec8, 0x000bc708, 0x000bc728, 0x000bc748, 0x000bff88, 0x000befa8,
+    0x000befc8, 0x000ff7e8, 0x000cf028, 0x000cf048, 0x000cf068, 0x00100888, 0x0022e0a8, 0x000c7908,
+    0x000c7948, 0x000c7968, 0x000c11a8, 0x000c01c8, 0x000c59e8, 0x000cb228, 0x000c4a48, 0x000c2a68,
+    0x000d3288, 0x000d32c8, 0x000d32e8, 0x000d3308, 0x000dc328, 0x00232348, 0x0010a388, 0x0010a3a8,
+    0x0010a3c8, 0x00103be8, 0x00233c08, 0x00286428, 0x00101ca8, 0x0010fd08, 0x0010fd48, 0x00144568,
+    0x000c4dc8, 0x000c4e08, 0x000f9628, 0x000c8e68, 0x00108688, 0x0013cea8, 0x000baf08, 0x000baf48,
+    0x000baf68, 0x000b37a8, 0x000c5fc8, 0x000fa7e8, 0x000b3028, 0x000c5848, 0x000fa068, 0x00133888,
+    0x000c40e8, 0x000c4128, 0x000c4148, 0x000bc988, 0x000bc9a8, 0x000bc9c8, 0x000bca08, 0x000bca28,
+    0x000bca48, 0x000fd268, 0x000be2a8, 0x000be2c8, 0x000be2e8, 0x000feb08, 0x00128328, 0x000c9b88,
+    0x000c9bc8, 0x000c9be8, 0x000c6c28, 0x000c2448, 0x000c7c68, 0x000c9ca8, 0x000c34c8, 0x000c24e8,
+    0x000d1d08, 0x000cc548, 0x000cc568, 0x000c6d88, 0x000dbda8, 0x000e75c8, 0x000df608, 0x000d7628,
+    0x000d7648, 0x000e7e68, 0x000f4688, 0x002326a8, 0x000e7a2c, 0x000ebb0c, 0x00112b2c, 0x00111ba8,
+    0x0011fc08, 0x0011fc48, 0x00154468, 0x000d4cc8, 0x000d4d08, 0x00109528, 0x000d8d68, 0x00118588,
+    0x0014cda8, 0x000c2608, 0x000c2648, 0x000c2668, 0x000baea8, 0x000cd6c8, 0x00101ee8, 0x000baf28,
+    0x000cd748, 0x00101f68, 0x0013b788, 0x000c77e8, 0x000c7028, 0x000c7048, 0x000c2888, 0x000bf8a8,
+    0x000bf8c8, 0x000c5908, 0x000bf928, 0x000bf948, 0x00100168, 0x000c31a8, 0x000c31c8, 0x000c31e8,
+    0x00100208, 0x00129a28, 0x000cca88, 0x000ccac8, 0x000ccae8, 0x000d0b28, 0x000ca348, 0x000cab68,
+    0x000d3ba8, 0x000cd3c8, 0x000c7be8, 0x000dbc08, 0x000d1448, 0x000d1468, 0x000cbc88, 0x000e0ca8,
+    0x000ec4c8, 0x000e1508, 0x000d7528, 0x000d7548, 0x000e9d68, 0x000f6588, 0x0010d5a8, 0x000ee22c,
+    0x000eceac, 0x0011a048, 0x001280a8, 0x001280e8, 0x0015c908, 0x000dd168, 0x000dd1a8, 0x001119c8,
+    0x000e1208, 0x00120a28, 0x00155248, 0x000caaa8, 0x000caae8, 0x000cab08, 0x000c5b48, 0x000d5b68,
+    0x0010a388, 0x000c7bc8, 0x000d5be8, 0x0010a408, 0x00143c28, 0x000c8c88, 0x000c8cc8, 0x000c8ce8,
+    0x000c5528, 0x000c1548, 0x000c1568, 0x000c85a8, 0x000c1dc8, 0x000c1de8, 0x00101e08, 0x000c5e48,
+    0x000c5e68, 0x000c5e88, 0x00101ea8, 0x0012b6c8, 0x000ce728, 0x000ce768, 0x000ce788, 0x000d5fc8,
+    0x000cf7e8, 0x000cc008, 0x000d8848, 0x000d2068, 0x000cc888, 0x000e08a8, 0x000d60e8, 0x000d6108,
+    0x000d0928, 0x000e5948, 0x000f1168, 0x000e11a8, 0x000d71c8, 0x000d71e8, 0x000e9a08, 0x000f6228,
+    0x0010d248, 0x001fd361, 0x001fd381, 0x001fd3a1, 0x00328bc0, 0x001fd3e1, 0x001fd401, 0x00337420,
+    0x001fd441, 0x0033c460, 0x0033d480, 0x0016d4a1, 0x00174cc1, 0x003424e0, 0x00174d01, 0x00347520,
+    0x00348540, 0x0016d561, 0x0034c580, 0x0034d5a0, 0x0034e5c0, 0x00183de1, 0x00183e01, 0x00284e20,
+    0x00183e41, 0x00289e60, 0x00289e80, 0x0016d6a1, 0x0028eec0, 0x00354ee0, 0x00355f00, 0x00173f21,
+    0x0029af40, 0x00354f60, 0x00355f80, 0x00356fa0, 0x00183fc1, 0x00192fe1, 0x002a7800, 0x00192821,
+    0x002a7840, 0x002ac860, 0x0016d081, 0x002930a0, 0x002a40c0, 0x002a40e0, 0x00173901, 0x0029c920,
+    0x002ad940, 0x002ad960, 0x0035c980, 0x001739a1, 0x002c21c0, 0x002c21e0, 0x002c2200, 0x00359220,
+    0x0034a240, 0x00183a61, 0x00192a81, 0x0029baa0, 0x00192ac1, 0x002abae0, 0x002b0b00, 0x0016d321,
+    0x00293b40, 0x002a4b60, 0x002a9b80, 0x00173ba1, 0x0029d3c0, 0x002ae3e0, 0x002b3400, 0x0026fc20,
+    0x00173c41, 0x002c2c60, 0x002c2c80, 0x002c7ca0, 0x002774c0, 0x00272ce0, 0x00173d01, 0x002b3d20,
+    0x002dbd40, 0x002dbd60, 0x0027a580, 0x002755a0, 0x00273dc0, 0x0009ade5, 0x000a1e05, 0x0016be24,
+    0x000a1e45, 0x0016be64, 0x0016be84, 0x00090ea5, 0x0015cec4, 0x001646e4, 0x00164704, 0x0009af25,
+    0x00170744, 0x00177f64, 0x00177f84, 0x0014dfa4, 0x0009afc5, 0x0018dfe4, 0x0018d804, 0x0018d824,
+    0x0015b844, 0x00167064, 0x0009a885, 0x001970a4, 0x001a60c4, 0x001a60e4, 0x00169904, 0x00172924,
+    0x0017d144, 0x0009a965, 0x0019b184, 0x001aa1a4, 0x001aa1c4, 0x001799e4, 0x00183204, 0x0018da24,
+    0x00199244, 0x00099265, 0x000a0285, 0x00176aa4, 0x000a02c5, 0x00176ae4, 0x00176b04, 0x0008f325,
+    0x00167b44, 0x0016f364, 0x0016f384, 0x000993a5, 0x0016f3c4, 0x00176be4, 0x00176c04, 0x0014cc24,
+    0x00099445, 0x0018e464, 0x0018e484, 0x0018e4a4, 0x0015c4c4, 0x00162ce4, 0x00099505, 0x00197d24,
+    0x001a6d44, 0x001a6d64, 0x0016a584, 0x00170da4, 0x0017b5c4, 0x000995e5, 0x0019d604, 0x001ac624,
+    0x001ac644, 0x0017be64, 0x00182e84, 0x0018d6a4, 0x00197ec4, 0x0008d706, 0x00094726, 0x00094746,
+    0x0007ef66, 0x00081f86, 0x0008cfa6, 0x00098fc6, 0x000a77e6, 0x00099005, 0x000a0025, 0x00186844,
+    0x000a0065, 0x00186884, 0x001868a4, 0x0008f0c5, 0x001778e4, 0x0017f104, 0x0017f124, 0x00099145,
+    0x0017f164, 0x00186984, 0x001869a4, 0x0015c9c4, 0x000991e5, 0x00195a04, 0x00195a24, 0x00195a44,
+    0x00163a64, 0x0016a284, 0x000992a5, 0x0019aac4, 0x001a9ae4, 0x001a9b04, 0x0016d324, 0x00173b44,
+    0x0017cb64, 0x00099385, 0x001a03a4, 0x001af3c4, 0x001af3e4, 0x0017ec04, 0x00185c24, 0x0018ec44,
+    0x00197c64, 0x0009a4a6, 0x000a14c6, 0x000a14e6, 0x0008bd06, 0x0008ed26, 0x00092d46, 0x0009bd66,
+    0x000aa586, 0x00095dc6, 0x0009cde6, 0x0009ce06, 0x00087626, 0x0008a646, 0x0008e666, 0x00098e86,
+    0x000a8ea6, 0x000996e5, 0x000a0705, 0x0018f724, 0x000a0745, 0x0018f764, 0x0018f784, 0x0008f7a5,
+    0x001807c4, 0x00187fe4, 0x00187804, 0x00099025, 0x00187844, 0x0018f064, 0x0018f084, 0x001650a4,
+    0x000990c5, 0x0019e0e4, 0x0019e104, 0x0019e124, 0x0016c144, 0x00172964, 0x00099185, 0x0019c1a4,
+    0x001ab1c4, 0x001ab1e4, 0x0016ea04, 0x00175224, 0x0017e244, 0x00099265, 0x001a1a84, 0x001b0aa4,
+    0x001b0ac4, 0x001802e4, 0x00187304, 0x00190324, 0x00197b44, 0x000a1386, 0x000a83a6, 0x000a83c6,
+    0x00092be6, 0x00095c06, 0x00099c26, 0x0009d446, 0x000abc66, 0x0009e4a6, 0x000a54c6, 0x000a54e6,
+    0x0008fd06, 0x00092d26, 0x00096d46, 0x0009a566, 0x000aa586, 0x0009e5e6, 0x000a5606, 0x000a5626,
+    0x0008fe46, 0x00092e66, 0x00096e86, 0x0009a6a6, 0x000aa6c6, 0x001fd721, 0x001fd741, 0x001fd761,
+    0x0035ff80, 0x001fd7a1, 0x001fd7c1, 0x0035f7e0, 0x001fd001, 0x00360820, 0x00361840, 0x0016d061,
+    0x0017c081, 0x003668a0, 0x0018b0c1, 0x003680e0, 0x00369100, 0x0016e921, 0x00361940, 0x00361960,
+    0x00361980, 0x001839a1, 0x001839c1, 0x002a91e0, 0x00192a01, 0x002c2a20, 0x00370a40, 0x0016ea61,
+    0x002a3280, 0x003692a0, 0x003692c0, 0x001752e1, 0x002abb00, 0x00365b20, 0x00365b40, 0x0035fb60,
+    0x00183b81, 0x0019a3a1, 0x002d0bc0, 0x0019a3e1, 0x002d0c00, 0x002c9c20, 0x0016ec41, 0x002a6c60,
+    0x002c1480, 0x0036f4a0, 0x001754c1, 0x002af4e0, 0x002c9d00, 0x0036bd20, 0x00366d40, 0x00175561,
+    0x002d2580, 0x002d25a0, 0x003685c0, 0x00363de0, 0x00352600, 0x00183e21, 0x0019a641, 0x002c7e60,
+    0x001b0e81, 0x002f46a0, 0x002ed6c0, 0x0016eee1, 0x002a9700, 0x002c3f20, 0x002dd740, 0x00175761,
+    0x002b1f80, 0x002cc7a0, 0x002e5fc0, 0x0036c7e0, 0x00175001, 0x002d4820, 0x002d4840, 0x002ee060,
+    0x00369080, 0x003578a0, 0x001750c1, 0x002c68e0, 0x002f6900, 0x002f6920, 0x00367140, 0x00355960,
+    0x00344980, 0x0009a9a5, 0x000a49c5, 0x001891e4, 0x000aea05, 0x0019fa24, 0x00198244, 0x00090a65,
+    0x0016f284, 0x0017e2a4, 0x0018d2c4, 0x0009aae5, 0x0017f304, 0x0018e324, 0x0019d344, 0x00184b64,
+    0x0009ab85, 0x0019cba4, 0x0019cbc4, 0x001abbe4, 0x00190404, 0x00198424, 0x0009c445, 0x001a2464,
+    0x001b8c84, 0x001b8ca4, 0x001a64c4, 0x001fece4, 0x00200504, 0x000a2525, 0x001a6544, 0x001bcd64,
+    0x001d3584, 0x001b35a4, 0x00202dc4, 0x002045e4, 0x00205e04, 0x00099625, 0x000a3645, 0x0018d664,
+    0x000ad685, 0x001a3ea4, 0x0019c6c4, 0x000936e5, 0x00173704, 0x00182724, 0x00191744, 0x00099765,
+    0x0017af84, 0x00189fa4, 0x00198fc4, 0x00184fe4, 0x00099005, 0x00199824, 0x00199844, 0x001a8864,
+    0x00191884, 0x001938a4, 0x0009c8c5, 0x001a08e4, 0x001b7104, 0x001b7124, 0x001a9144, 0x001ad964,
+    0x001b6184, 0x000a29a5, 0x001a61c4, 0x001bc9e4, 0x001d3204, 0x001b7a24, 0x001bc244, 0x001c4a64,
+    0x00204284, 0x00093ac6, 0x0009d2e6, 0x000a7306, 0x0009d326, 0x000a0346, 0x000aa366, 0x000c9386,
+    0x000cd3a6, 0x000993c5, 0x000a33e5, 0x00197404, 0x000ad425, 0x001adc44, 0x001a6464, 0x0009ac85,
+    0x00182ca4, 0x0018c4c4, 0x0019b4e4, 0x00099505, 0x00184d24, 0x00193d44, 0x001a2d64, 0x0019f584,
+    0x0009bda5, 0x0019b5c4, 0x0019b5e4, 0x001aa604, 0x001a3e24, 0x001a6644, 0x000a0665, 0x001a2684,
+    0x001b8ea4, 0x001b8ec4, 0x001b2ee4, 0x001b7704, 0x001be724, 0x000a6745, 0x001a7f64, 0x001be784,
+    0x001d4fa4, 0x001c17c4, 0x001c5fe4, 0x001cc804, 0x001d8024, 0x0009f866, 0x000a5886, 0x000af8a6,
+    0x000a90c6, 0x000ac0e6, 0x000af106, 0x000ba126, 0x000c4146, 0x0009f186, 0x000a11a6, 0x000ab1c6,
+    0x000a89e6, 0x000a9a06, 0x000aca26, 0x000b9246, 0x000c4a66, 0x000992a5, 0x000a32c5, 0x0019fae4,
+    0x000ad305, 0x001b6324, 0x001aeb44, 0x0009ab65, 0x0018b384, 0x00194ba4, 0x001a3bc4, 0x000993e5,
+    0x0018d404, 0x0019c424, 0x001ab444, 0x001a7c64, 0x0009bc85, 0x001a3ca4, 0x001a3cc4, 0x001b2ce4,
+    0x001ac504, 0x001aed24, 0x000a0545, 0x001a3d64, 0x001ba584, 0x001ba5a4, 0x001b45c4, 0x001b8de4,
+    0x001bfe04, 0x000a6625, 0x001a9644, 0x001bfe64, 0x001d6684, 0x001c2ea4, 0x001c76c4, 0x001ce6e4,
+    0x001d8704, 0x000a6f46, 0x000acf66, 0x000b6f86, 0x000b07a6, 0x000b37c6, 0x000b67e6, 0x000bb806,
+    0x000c5826, 0x000a7866, 0x000a9886, 0x000b38a6, 0x000b10c6, 0x000b20e6, 0x000b5106, 0x000ba926,
+    0x000c6146, 0x000af1a6, 0x000ac1c6, 0x000b39e6, 0x000b8a06, 0x000b9a26, 0x000bca46, 0x000be266,
+    0x000c9a86, 0x004aaae1, 0x004aab01, 0x00783320, 0x004aab41, 0x0078bb60, 0x0078d380, 0x004aaba1,
+    0x007943c0, 0x00795be0, 0x00797400, 0x004a2421, 0x0079b440, 0x0079cc60, 0x0079e480, 0x00547ca0,
+    0x004a24c1, 0x007a3ce0, 0x007a3d00, 0x007a5520, 0x0054ed40, 0x00547d60, 0x004a2581, 0x007a25a0,
+    0x007aadc0, 0x007aade0, 0x00554600, 0x0054d620, 0x00546640, 0x004a2661, 0x0079f680, 0x007a7ea0,
+    0x007b06c0, 0x005706e0, 0x00569700, 0x00562720, 0x0055b740, 0x00202f63, 0x0048ef82, 0x0048efa2,
+    0x0048efc2, 0x00326fe2, 0x0032f002, 0x00336022, 0x0033b842, 0x00356062, 0x00201083, 0x004928a2,
+    0x004928c2, 0x004928e2, 0x0032a902, 0x0032a922, 0x00333142, 0x0033a162, 0x00356182, 0x001579a3,
+    0x002011c3, 0x0049c9e2, 0x0049ca02, 0x0049ca22, 0x00334a42, 0x00334a62, 0x00334a82, 0x0033baa2,
+    0x00357ac2, 0x001602e3, 0x0015bb03, 0x00201323, 0x004a5342, 0x004a5362, 0x004a5382, 0x0033d3a2,
+    0x0033d3c2, 0x0033d3e2, 0x0033d402, 0x00359422, 0x00167443, 0x00164463, 0x00164483, 0x001feca1,
+    0x001fecc1, 0x001fece1, 0x00371d00, 0x001fed21, 0x001fed41, 0x0036fd60, 0x001fed81, 0x003715a0,
+    0x003725c0, 0x001855e1, 0x00185601, 0x00374620, 0x0018ce41, 0x00375e60, 0x00376e80, 0x00186ea1,
+    0x0036f6c0, 0x0036f6e0, 0x0036f700, 0x00185721, 0x00185741, 0x002b2760, 0x00194781, 0x002cbfa0,
+    0x00379fc0, 0x00186fe1, 0x002af800, 0x00372020, 0x00372040, 0x0018d061, 0x002b4880, 0x0036e8a0,
+    0x0036e8c0, 0x003688e0, 0x00185101, 0x0019b921, 0x002db140, 0x0019b961, 0x002db180, 0x002d41a0,
+    0x001871c1, 0x002bf9e0, 0x002ca200, 0x00378220, 0x0018d241, 0x002baa60, 0x002d1280, 0x003732a0,
+    0x0036e2c0, 0x0018d2e1, 0x002d8300, 0x002d8320, 0x0036e340, 0x00369b60, 0x00358380, 0x001853a1,
+    0x0019bbc1, 0x002cf3e0, 0x001b2401, 0x002fbc20, 0x002f4c40, 0x0018bc61, 0x002c7c80, 0x002cb4a0,
+    0x002e4cc0, 0x0018d4e1, 0x002c2d00, 0x002d2520, 0x002ebd40, 0x00372560, 0x0018d581, 0x002d95a0,
+    0x002d95c0, 0x002f2de0, 0x0036de00, 0x0035c620, 0x0018d641, 0x002c9e60, 0x002f9e80, 0x002f9ea0,
+    0x0036a6c0, 0x00358ee0, 0x00347f00, 0x0009af25, 0x000a4f45, 0x00193f64, 0x000aef85, 0x001aa7a4,
+    0x001a2fc4, 0x0009d7e5, 0x00188004, 0x00188824, 0x00197844, 0x000a4865, 0x00192084, 0x001958a4,
+    0x001a48c4, 0x001ae8e4, 0x000a4905, 0x001a1124, 0x001a1144, 0x001b0164, 0x001b2984, 0x001fd9a4,
+    0x000a49c5, 0x001a81e4, 0x001bea04, 0x001bea24, 0x001c2a44, 0x00203264, 0x00203284, 0x000a72a5,
+    0x001b12c4, 0x001c2ae4, 0x001d9304, 0x001cb324, 0x00207344, 0x00207364, 0x00207384, 0x0009aba5,
+    0x000a4bc5, 0x0019abe4, 0x000aec05, 0x001b1424, 0x001a9c44, 0x0009f465, 0x0018f484, 0x0018fca4,
+    0x0019ecc4, 0x0009e4e5, 0x0018d504, 0x00197524, 0x001a6544, 0x001a9d64, 0x0009f585, 0x001a2da4,
+    0x001a2dc4, 0x001b1de4, 0x001b2604, 0x001b4624, 0x000a4645, 0x001a8664, 0x001bee84, 0x001beea4,
+    0x001c0ec4, 0x001c2ee4, 0x00203704, 0x000a9725, 0x001b1744, 0x001c2f64, 0x001d9784, 0x001cb7a4,
+    0x001cdfc4, 0x002077e4, 0x00207004, 0x000a0046, 0x000a4866, 0x000ae886, 0x000a98a6, 0x000ac8c6,
+    0x000c80e6, 0x000cd906, 0x000d1926, 0x0009a945, 0x000a4965, 0x001a0184, 0x000ae9a5, 0x001b69c4,
+    0x001af1e4, 0x000a5205, 0x001a2224, 0x0019da44, 0x001a4264, 0x000a2285, 0x001a02a4, 0x0019cac4,
+    0x001abae4, 0x001bcb04, 0x000a2325, 0x001a4344, 0x001a4364, 0x001b3384, 0x001ba3a4, 0x001bcbc4,
+    0x000a83e5, 0x001aac04, 0x001bec24, 0x001bec44, 0x001c9c64, 0x001cbc84, 0x001ce4a4, 0x000ad4c5,
+    0x001ba4e4, 0x001c2d04, 0x001d9524, 0x001d4544, 0x001d6d64, 0x001d8d84, 0x002075a4, 0x000a9de6,
+    0x000aa606, 0x000b4626, 0x000b3646, 0x000b6666, 0x000b7686, 0x000cdea6, 0x000d1ec6, 0x000aaf06,
+    0x000aa726, 0x000b4746, 0x000b4766, 0x000b4786, 0x000b77a6, 0x000cdfc6, 0x000d1fe6, 0x0009d825,
+    0x000a4845, 0x001a4064, 0x000ae885, 0x001ba8a4, 0x001b30c4, 0x000a90e5, 0x001af104, 0x001aa924,
+    0x001a8144, 0x000a6165, 0x001ad184, 0x001a89a4, 0x001af9c4, 0x001c99e4, 0x000a6205, 0x001a8224,
+    0x001a8244, 0x001b7264, 0x001c7284, 0x001c9aa4, 0x000a92c5, 0x001ad2e4, 0x001beb04, 0x001beb24,
+    0x001cbb44, 0x001ce364, 0x001d0384, 0x000af3a5, 0x001bebc4, 0x001c2be4, 0x001d9404, 0x001d8c24,
+    0x001db444, 0x001dd464, 0x001e5484, 0x000afcc6, 0x000ae4e6, 0x000b8506, 0x000b9526, 0x000bc546,
+    0x000bd566, 0x000c0d86, 0x000cada6, 0x000b1de6, 0x000aee06, 0x000b8626, 0x000bb646, 0x000bb666,
+    0x000be686, 0x000c1ea6, 0x000d1ec6, 0x000b7f26, 0x000b4f46, 0x000b8766, 0x000c1786, 0x000c17a6,
+    0x000c17c6, 0x000c5fe6, 0x000d1806, 0x004ac061, 0x004ac081, 0x007950a0, 0x004ac0c1, 0x0079d8e0,
+    0x0079f100, 0x004ac121, 0x007a4940, 0x007a6160, 0x007a7980, 0x004a39a1, 0x007a89c0, 0x007aa1e0,
+    0x007aba00, 0x00555220, 0x004a3a41, 0x007aca60, 0x007aca80, 0x007ae2a0, 0x00557ac0, 0x00550ae0,
+    0x004a3b01, 0x007acb20, 0x007b5340, 0x007b5360, 0x0055d380, 0x00554ba0, 0x0054c3c0, 0x004a3be1,
+    0x007a6c00, 0x007af420, 0x007b7c40, 0x00577c60, 0x0056f480, 0x00566ca0, 0x0055e4c0, 0x00202ce3,
+    0x00499502, 0x00499522, 0x00499542, 0x00331562, 0x00336d82, 0x0033ada2, 0x00341dc2, 0x0035c5e2,
+    0x00202e03, 0x004a0622, 0x004a0642, 0x004a0662, 0x00338682, 0x003386a2, 0x0033c6c2, 0x00341ee2,
+    0x0035c702, 0x0015f723, 0x00202f43, 0x004a5f62, 0x004a5f82, 0x004a5fa2, 0x0033dfc2, 0x0033dfe2,
+    0x0033d802, 0x00341822, 0x0035c042, 0x00164863, 0x00164883, 0x002028a3, 0x004a98c2, 0x004a98e2,
+    0x004a9902, 0x00341922, 0x00341942, 0x00341962, 0x00341982, 0x0035c1a2, 0x001689c3, 0x001689e3,
+    0x00168a03, 0x004ac221, 0x004ac241, 0x007a2a60, 0x004ac281, 0x007a6aa0, 0x007a82c0, 0x004adae1,
+    0x007adb00, 0x007adb20, 0x007adb40, 0x004a5361, 0x007b0380, 0x007b03a0, 0x007b03c0, 0x00601be0,
+    0x004a5401, 0x007b2c20, 0x007b2c40, 0x007b2c60, 0x00605c80, 0x005fbca0, 0x004a54c1, 0x007afce0,
+    0x007b5500, 0x007b5520, 0x0063fd40, 0x00635d60, 0x0062d580, 0x004a55a1, 0x007ae5c0, 0x007b3de0,
+    0x007b7e00, 0x00643e20, 0x00639e40, 0x00631660, 0x0065a680, 0x00202ea3, 0x0049dec2, 0x0049dee2,
+    0x0049df02, 0x003b1f22, 0x003b5f42, 0x003b9f62, 0x003dbf82, 0x003dffa2, 0x00202fc3, 0x004a1fe2,
+    0x004a1802, 0x004a1822, 0x003b5842, 0x003b5862, 0x003b9882, 0x003db8a2, 0x003df8c2, 0x0019b0e3,
+    0x00202903, 0x004a5922, 0x004a5942, 0x004a5962, 0x003d0182, 0x003d01a2, 0x003d01c2, 0x003ea9e2,
+    0x003eea02, 0x001a5a23, 0x001a5a43, 0x00202a63, 0x004a9a82, 0x004a9aa2, 0x004a9ac2, 0x003d42e2,
+    0x003d4302, 0x003d4322, 0x003eab42, 0x003eeb62, 0x001a9b83, 0x001a9ba3, 0x001b3bc3, 0x01b0fbe1,
+    0x02b35c00, 0x02b39c20, 0x02b3dc40, 0x01071c60, 0x01071c80, 0x01071ca0, 0x01071cc0, 0x01071ce0,
+    0x00a41d01, 0x00a45d21, 0x00a49d41, 0x00a4dd61,
+};
+
+static inline uint8_t hold_rank_lookup(uint16_t rank) {
+    uint16_t bit = rank * HOLD_BITS;
+    return ((HOLD_TABLE[bit >> 3] | (HOLD_TABLE[(bit >> 3) + 1] << 8)) >> (bit & 7)) & ((1 << HOLD_BITS) - 1);
+}
+
+// the HOLD_BITS bits of the best hold of the 5 card mask
+static inline uint8_t hold_lookup(uint32_t mask) {
+    return hold_rank_lookup(hand_rank(mask));
+}
+
+// the HOLD_BITS bits of the best hold of the 5 card mask with Royal paying jackpot
+static inline uint8_t hold_lookup_jackpot(uint32_t mask, uint64_t jackpot) {
+    uint16_t rank = hand_rank(mask);
+    uint8_t low_rank = rank & ((1 << HOLD_BREAK_RANK_BITS) - 1);
+    uint32_t end = HOLD_BREAK_BUCKETS[(rank >> HOLD_BREAK_RANK_BITS) + 1];
+    // the first break of rank in its bucket, or of the next rank that has any
+    uint32_t low = HOLD_BREAK_BUCKETS[rank >> HOLD_BREAK_RANK_BITS];
+    uint32_t high = end;
+    while (low < high) {
+        uint32_t mid = (low + high) / 2;
+        if (((HOLD_BREAKS[mid] >> HOLD_BITS) & ((1 << HOLD_BREAK_RANK_BITS) - 1)) < low_rank) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    uint8_t hold = hold_rank_lookup(rank);
+    for (; low < end && ((HOLD_BREAKS[low] >> HOLD_BITS) & ((1 << HOLD_BREAK_RANK_BITS) - 1)) == low_rank &&
+           jackpot >= HOLD_BREAKS[low] >> (HOLD_BREAK_RANK_BITS + HOLD_BITS); low++) {
+        hold = HOLD_BREAKS[low] & ((1 << HOLD_BITS) - 1);
+    }
+    return hold;
+}
+
+// the cards of the 5 card mask that the HOLD_BITS bits hold keep
+static inline uint32_t hold_cards(uint32_t mask, uint8_t hold) {
+    uint32_t held = 0;
+    for (uint8_t i = 0; i < 5; i++, mask &= mask - 1) {
+        if (hold & (1 << i)) {
+            held |= mask & -mask;
+        }
+    }
+    return held;
+}
+
+// the HOLD_BITS bits that keep the held cards of the 5 card mask, hold_cards the other way
+static inline uint8_t hold_bits(uint32_t mask, uint32_t held) {
+    uint8_t hold = 0;
+    for (uint8_t i = 0; i < 5; i++, mask &= mask - 1) {
+        if (held & mask & -mask) {
+            hold |= 1 << i;
+        }
+    }
+    return hold;
+}
+
+// the cards of the 5 card mask to hold
+static inline uint32_t hold_lookup_cards(uint32_t mask) {
+    return hold_cards(mask, hold_lookup(mask));
+}
+
+// the cards of the 5 card mask to hold with Royal paying jackpot
+static inline uint32_t hold_lookup_jackpot_cards(uint32_t mask, uint64_t jackpot) {
+    return hold_cards(mask, hold_lookup_jackpot(mask, jackpot));
+}
+
+#endif // bird_poker_HOLD_TABLE_H_
@@ -0,0 +1,59 @@
+#ifndef bird_poker_LOG_H_
+#define bird_poker_LOG_H_
+
+// Hand history of the face and the simulators, one bird_poker_round_t per round. The face fills it in
+// handleEvent_DEAL, handleEvent_REDRAW and handleEvent_SETTLE when built with BIRD_POKER_LOG and hands it to
+// bird_poker_log_round at settle; the host tools link tools/hand_log.c for that, which writes the rounds
+// to a binary log, see tools/hand_log.h.
+
+#include <stdint.h>
+#include "bird_poker_score.h"
+#include "bird_poker_deal.h"
+#include "bird_poker_hold_table.h"
+
+typedef struct {
+    uint16_t deal;    // hand_rank of the 5 dealt cards
+    uint8_t hold;     // bit i holds the i-th lowest dealt card, hold_bits of the held cards
+    uint16_t redraw;  // log_redraw_rank of the redrawn cards, 0 when all are held
+    uint8_t hands;    // hands of the deal, coins in
+    uint8_t score;    // (combi << 4) | highc of the hand after the redraw
+    uint64_t prize;   // of all hands of the deal
+    uint64_t balance; // after settle
+    uint64_t jackpot; // after settle
+} bird_poker_round_t;
+
+void bird_poker_log_round(const bird_poker_round_t *round);
+
+// colexicographic rank of the redrawn cards among the 12 cards not dealt, below C(12, cards redrawn)
+static inline uint16_t log_redraw_rank(uint32_t dealt, uint32_t drawn) {
+    uint16_t rank = 0;
+    uint8_t k = 1;
+    uint32_t left = DECK_MASK & ~dealt;
+    for (uint8_t i = 0; left; i++, left &= left - 1) {
+        if (drawn & left & -left) {
+            rank += HAND_BINOM[i][k++];
+        }
+    }
+    return rank;
+}
+
+// the count redrawn cards of rank rank among the 12 cards not dealt
+static inline uint32_t log_redraw_unrank(uint32_t dealt, uint8_t count, uint16_t rank) {
+    uint8_t left[12];
+    uint32_t cards = DECK_MASK & ~dealt;
+    for (uint8_t i = 0; i < 12; i++, cards &= cards - 1) {
+        left[i] = lowest_bit(cards);
+    }
+    uint32_t drawn = 0;
+    uint8_t n = 12;
+    for (uint8_t k = count; k >= 1; k--) {
+        do {
+            n--;
+        } while (HAND_BINOM[n][k] > rank);
+        rank -= HAND_BINOM[n][k];
+        drawn |= 1u << left[n];
+    }
+    return drawn;
+}
+
+#endif // bird_poker_LOG_H_
@@ -0,0 +1,88 @@
+#ifndef bird_poker_RANGES_H_
+#define bird_poker_RANGES_H_
+
+// Work stealing over the items [0, items) of a host tool, by threads that each take from a range of their own:
+// ranges_init splits the items evenly, ranges_take hands out the next item of a range, and a range that runs
+// out steals the upper half of the largest one left. Host only, it needs pthreads.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+typedef struct {
+    pthread_mutex_t lock;
+    uint64_t next; // the items [next, end) left to this range
+    uint64_t end;
+} __attribute__((aligned(64))) ranges_range_t;
+
+typedef struct {
+    ranges_range_t *ranges;
+    int count;
+} ranges_t;
+
+// count ranges over the items [0, items), the last one takes what doesn't divide
+static inline void ranges_init(ranges_t *r, int count, uint64_t items) {
+    r->count = count;
+    r->ranges = aligned_alloc(64, count * sizeof(ranges_range_t));
+    for (int i = 0; i < count; i++) {
+        pthread_mutex_init(&r->ranges[i].lock, NULL);
+        r->ranges[i].next = items / count * i;
+        r->ranges[i].end = i + 1 == count ? items : items / count * (i + 1);
+    }
+}
+
+static inline void ranges_free(ranges_t *r) {
+    for (int i = 0; i < r->count; i++) {
+        pthread_mutex_destroy(&r->ranges[i].lock);
+    }
+    free(r->ranges);
+    r->ranges = NULL;
+}
+
+// the next item of range t, stolen from the range with the most left when t has none; 0 when all are taken
+static inline int ranges_take(ranges_t *r, int t, uint64_t *item) {
+    ranges_range_t *own = &r->ranges[t];
+    pthread_mutex_lock(&own->lock);
+    if (own->next < own->end) {
+        *item = own->next;
+        __atomic_store_n(&own->next, own->next + 1, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&own->lock);
+        return 1;
+    }
+    pthread_mutex_unlock(&own->lock);
+    for (;;) {
+        ranges_range_t *victim = NULL;
+        uint64_t most = 0;
+        for (int v = 0; v < r->count; v++) {
+            // unlocked, a guess that the lock below settles
+            uint64_t next = __atomic_load_n(&r->ranges[v].next, __ATOMIC_RELAXED);
+            uint64_t end = __atomic_load_n(&r->ranges[v].end, __ATOMIC_RELAXED);
+            if (v != t && end > next && end - next > most) {
+                victim = &r->ranges[v];
+                most = end - next;
+            }
+        }
+        if (!victim) {
+            return 0;
+        }
+        pthread_mutex_lock(&victim->lock);
+        uint64_t next = victim->next;
+        uint64_t end = victim->end;
+        if (next >= end) {
+            // taken meanwhile, look again
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+        uint64_t mid = next + (end - next) / 2;
+        __atomic_store_n(&victim->end, mid, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&victim->lock);
+        pthread_mutex_lock(&own->lock);
+        *item = mid;
+        __atomic_store_n(&own->next, mid + 1, __ATOMIC_RELAXED);
+        __atomic_store_n(&own->end, end, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&own->lock);
+        return 1;
+    }
+}
+
+#endif // bird_poker_RANGES_H_
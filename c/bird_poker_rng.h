@@ -0,0 +1,84 @@
+#ifndef bird_poker_RNG_H_
+#define bird_poker_RNG_H_
+
+// Counter based random streams (Philox4x32-10), shared by the watch face and the host tools in tools/.
+// Word i of stream s under key k is a pure function of (k, s, i): the same stream replays bit identical
+// on the watch, the emulator and the host, streams per thread or player never overlap and
+// bird_poker_rng_skip jumps ahead without drawing.
+
+#include <stdint.h>
+
+typedef struct {
+    uint32_t key[2];   // seed
+    uint32_t stream;
+    uint64_t position; // 32 bit words drawn
+    uint32_t block[4]; // block of position / 4
+} bird_poker_rng_t;
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+static inline void philox4x32_10(const uint32_t key[2], const uint32_t counter[4], uint32_t out[4]) {
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    for (uint8_t round = 0; round < 10; round++) {
+        uint64_t p0 = (uint64_t) PHILOX_M0 * c0;
+        uint64_t p1 = (uint64_t) PHILOX_M1 * c2;
+        c0 = (uint32_t) (p1 >> 32) ^ c1 ^ k0;
+        c2 = (uint32_t) (p0 >> 32) ^ c3 ^ k1;
+        c1 = (uint32_t) p1;
+        c3 = (uint32_t) p0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+static inline void bird_poker_rng_fill(bird_poker_rng_t *rng) {
+    uint64_t block = rng->position >> 2;
+    const uint32_t counter[4] = {(uint32_t) block, (uint32_t) (block >> 32), rng->stream, 0};
+    philox4x32_10(rng->key, counter, rng->block);
+}
+
+static inline void bird_poker_rng_seed(bird_poker_rng_t *rng, uint64_t seed, uint32_t stream) {
+    rng->key[0] = (uint32_t) seed;
+    rng->key[1] = (uint32_t) (seed >> 32);
+    rng->stream = stream;
+    rng->position = 0;
+    bird_poker_rng_fill(rng);
+}
+
+// moves the stream n words ahead (or back, n wraps)
+static inline void bird_poker_rng_skip(bird_poker_rng_t *rng, uint64_t n) {
+    rng->position += n;
+    bird_poker_rng_fill(rng);
+}
+
+static inline uint32_t bird_poker_rng_next(bird_poker_rng_t *rng) {
+    uint32_t r = rng->block[rng->position & 3];
+    rng->position++;
+    if ((rng->position & 3) == 0) {
+        bird_poker_rng_fill(rng);
+    }
+    return r;
+}
+
+// unbiased 0 <= r < n for n > 0 (Lemire's multiply and reject), divides only when the first
+// draw lands in the low n of a 2^32 product
+static inline uint32_t bird_poker_rng_below(bird_poker_rng_t *rng, uint32_t n) {
+    uint64_t m = (uint64_t) bird_poker_rng_next(rng) * n;
+    if ((uint32_t) m < n) {
+        uint32_t threshold = -n % n;
+        while ((uint32_t) m < threshold) {
+            m = (uint64_t) bird_poker_rng_next(rng) * n;
+        }
+    }
+    return m >> 32;
+}
+
+#endif // bird_poker_RNG_H_
@@ -0,0 +1,198 @@
+#ifndef bird_poker_SAVE_H_
+#define bird_poker_SAVE_H_
+
+// What the face keeps across a reset, packed into SAVE_WORDS backup registers:
+// byte 0-3   hand_rank of the dealt cards (13 bits), their order in hand[] (7 bits, Lehmer code against the
+//            cards low to high), discards (5), select_i (3), hands per deal (2, index of SAVE_HANDS), round (2)
+// byte 4     deal_hands
+// byte 5-6   SAVE_REDRAW: log_redraw_rank of the redrawn cards
+// byte 7-14  balance and jackpot as LEB128 varints, 7 bits a byte low first, the rest 0
+// byte 15    CRC-8 of bytes 0-14 from SAVE_VERSION, a torn or stale save doesn't restore
+// The round is SAVE_NONE between rounds, SAVE_HOLD from the deal while the hand is up for its hold, and
+// SAVE_REDRAW from the redraw to the settle: the redrawn cards go into the discarded ones' places low to high,
+// their order wasn't shown yet. A balance and jackpot that don't fit the 8 varint bytes (together about 2^56)
+// get a save with a CRC that fails, nothing restores rather than an older save. The card stream isn't saved, setup seeds a new one at boot. Check with tools/bench_face -c
+
+#include <string.h>
+#include "bird_poker_face.h"
+#include "bird_poker_score.h"
+#include "bird_poker_hands.h"
+#include "bird_poker_log.h"
+
+#define SAVE_WORDS 4
+#define SAVE_BYTES (SAVE_WORDS * 4)
+#define SAVE_VERSION 2
+#define SAVE_VARINTS 7
+
+#define SAVE_NONE 0
+#define SAVE_HOLD 1
+#define SAVE_REDRAW 2
+
+static const uint8_t SAVE_HANDS[4] = {1, 3, 10, MAX_HANDS};
+
+typedef struct {
+    uint32_t words[SAVE_WORDS];
+} bird_poker_save_t;
+
+// CRC-8, polynomial 0x07
+static inline uint8_t save_crc(const uint8_t *bytes, uint8_t n) {
+    uint8_t crc = SAVE_VERSION;
+    for (uint8_t i = 0; i < n; i++) {
+        crc ^= bytes[i];
+        for (uint8_t j = 0; j < 8; j++) {
+            crc = (crc << 1) ^ (crc & 0x80 ? 0x07 : 0);
+        }
+    }
+    return crc;
+}
+
+// appends x to bytes[*n..end), 0 when it doesn't fit
+static inline bool save_varint(uint8_t *bytes, uint8_t *n, uint8_t end, uint64_t x) {
+    do {
+        if (*n == end) {
+            return false;
+        }
+        bytes[(*n)++] = (x & 0x7F) | (x >= 0x80 ? 0x80 : 0);
+        x >>= 7;
+    } while (x);
+    return true;
+}
+
+static inline bool load_varint(const uint8_t *bytes, uint8_t *n, uint8_t end, uint64_t *x) {
+    *x = 0;
+    for (uint8_t shift = 0; *n < end && shift < 64; shift += 7) {
+        uint8_t b = bytes[(*n)++];
+        *x |= (uint64_t) (b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// the cards low to high of cards into hand[i] for the places i of slots
+static inline void save_place(uint8_t hand[5], uint8_t slots, uint32_t cards) {
+    for (uint8_t i = 0; i < 5; i++) {
+        if (slots & (1 << i)) {
+            hand[i] = lowest_bit(cards);
+            cards &= cards - 1;
+        }
+    }
+}
+
+// packs the balance, jackpot, hands per deal and the round: with SAVE_HOLD the dealt hand, discards and
+// select_i, with SAVE_REDRAW the redrawn hand, hands_dealt and hands_held, the discards the places of the
+// redrawn cards; false when the balance and jackpot don't fit, save is then one that save_unpack rejects
+static inline bool save_pack(const bird_poker_face_state_t *state, uint8_t round, uint8_t discards, uint8_t select_i,
+                             bird_poker_save_t *save) {
+    uint8_t bytes[SAVE_BYTES] = {0};
+    uint32_t head = 0;
+    if (round != SAVE_NONE) {
+        uint32_t dealt = state->dealt;
+        uint8_t hand[5];
+        memcpy(hand, state->hand, 5);
+        if (round == SAVE_REDRAW) {
+            // the hand as dealt, the discarded cards back in their places low to high
+            dealt = state->hands_dealt;
+            uint16_t redraw = log_redraw_rank(dealt, hand_mask(state->hand) & ~state->hands_held);
+            bytes[5] = redraw;
+            bytes[6] = redraw >> 8;
+            save_place(hand, discards, dealt & ~state->hands_held);
+        }
+        // position of each card of hand among the cards low to high, as a Lehmer code
+        uint8_t order = 0;
+        for (uint8_t i = 0; i < 5; i++) {
+            uint8_t smaller = 0;
+            for (uint8_t j = i + 1; j < 5; j++) {
+                smaller += hand[j] < hand[i];
+            }
+            order = order * (5 - i) + smaller;
+        }
+        head = hand_rank(dealt) | (uint32_t) order << 13 | (uint32_t) (discards & 0x1F) << 20 |
+               (uint32_t) select_i << 25 | (uint32_t) round << 30;
+        bytes[4] = state->deal_hands;
+    }
+    uint8_t hands = 0;
+    while (hands < 3 && SAVE_HANDS[hands] != state->hands) {
+        hands++;
+    }
+    head |= (uint32_t) hands << 28;
+    for (uint8_t i = 0; i < 4; i++) {
+        bytes[i] = head >> (8 * i);
+    }
+    uint8_t n = SAVE_VARINTS;
+    bool fits = save_varint(bytes, &n, SAVE_BYTES - 1, state->balance) &&
+                save_varint(bytes, &n, SAVE_BYTES - 1, state->jackpot);
+    bytes[SAVE_BYTES - 1] = save_crc(bytes, SAVE_BYTES - 1) ^ (fits ? 0 : 0xFF);
+    for (uint8_t i = 0; i < SAVE_WORDS; i++) {
+        save->words[i] = bytes[4 * i] | bytes[4 * i + 1] << 8 | bytes[4 * i + 2] << 16 | (uint32_t) bytes[4 * i + 3] << 24;
+    }
+    return fits;
+}
+
+// restores what save_pack packed into state, *round tells the round, with its discards and select_i; false
+// and state untouched when the save isn't valid
+static inline bool save_unpack(const bird_poker_save_t *save, bird_poker_face_state_t *state, uint8_t *round,
+                               uint8_t *discards, uint8_t *select_i) {
+    uint8_t bytes[SAVE_BYTES];
+    for (uint8_t i = 0; i < SAVE_BYTES; i++) {
+        bytes[i] = save->words[i / 4] >> (8 * (i % 4));
+    }
+    if (save_crc(bytes, SAVE_BYTES - 1) != bytes[SAVE_BYTES - 1]) {
+        return false;
+    }
+    uint32_t head = bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t) bytes[3] << 24;
+    uint8_t n = SAVE_VARINTS;
+    uint64_t balance;
+    uint64_t jackpot;
+    uint8_t redrawn = popcount16((head >> 20) & 0x1F);
+    uint16_t redraw = bytes[5] | bytes[6] << 8;
+    if (!load_varint(bytes, &n, SAVE_BYTES - 1, &balance) || !load_varint(bytes, &n, SAVE_BYTES - 1, &jackpot) ||
+        (head & 0x1FFF) >= HAND_COUNT || ((head >> 13) & 0x7F) >= 120 || head >> 30 > SAVE_REDRAW ||
+        (head >> 30 == SAVE_REDRAW && (redrawn == 0 || redraw >= HAND_BINOM[12][redrawn]))) {
+        return false;
+    }
+    *round = head >> 30;
+    *discards = (head >> 20) & 0x1F;
+    *select_i = (head >> 25) & 0x7;
+    if (*round != SAVE_NONE) {
+        // the cards low to high, hand[i] takes the one the Lehmer code picks of the ones left
+        uint32_t dealt = hand_unrank(head & 0x1FFF);
+        uint32_t cards = dealt;
+        uint8_t order = (head >> 13) & 0x7F;
+        uint8_t digits[5];
+        for (int8_t i = 4; i >= 0; i--) {
+            digits[i] = order % (5 - i);
+            order /= 5 - i;
+        }
+        for (uint8_t i = 0; i < 5; i++) {
+            uint32_t left = cards;
+            for (uint8_t k = 0; k < digits[i]; k++) {
+                left &= left - 1;
+            }
+            uint32_t card = left & -left;
+            state->hand[i] = lowest_bit(card);
+            cards &= ~card;
+        }
+        if (*round == SAVE_REDRAW) {
+            uint32_t drawn = log_redraw_unrank(dealt, redrawn, redraw);
+            state->hands_dealt = dealt;
+            state->hands_held = 0;
+            for (uint8_t i = 0; i < 5; i++) {
+                if (!(*discards & (1 << i))) {
+                    state->hands_held |= 1 << state->hand[i];
+                }
+            }
+            save_place(state->hand, *discards, drawn);
+            dealt |= drawn;
+        }
+        state->dealt = dealt;
+        state->deal_hands = bytes[4];
+    }
+    state->hands = SAVE_HANDS[(head >> 28) & 3];
+    state->balance = balance;
+    state->jackpot = jackpot;
+    return true;
+}
+
+#endif // bird_poker_SAVE_H_
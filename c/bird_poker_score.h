@@ -0,0 +1,398 @@
+#ifndef bird_poker_SCORE_H_
+#define bird_poker_SCORE_H_
+
+// Cards, combinations and scoring, shared by the watch face and the host tools in tools/
+
+#include <stdint.h>
+
+#define Royal 9
+#define FiveK 8
+#define StrFl 7
+#define FourK 6
+#define Strgt 5
+#define Flush 4
+#define Trips 3
+#define OnePr 2
+#define HighC 1
+
+static const uint8_t PAYOUTS_LENGTH = 9;
+static const char* const PAYOUTS_NAMES[] = {"  ", "H1", "P ", "3K", "FL", "St", "4K", "SF", "5K", "rF"};
+static const uint8_t PAYOUTS_PRIZES[] = {0, 0, 0, 1, 2, 3, 4, 10, 30, 250};
+
+#define CA 1
+#define C2 2
+#define C3 3
+#define C4 4
+#define C5 5
+#define C6 6
+#define C7 7
+#define C8 8
+#define C9 9
+#define CT 10
+#define CJ 11
+#define CQ 12
+#define CK 13
+#define W4 14
+#define W7 15
+#define WT 16
+#define WK 17
+// CAHigh only used in output, not in hnd, doesn't clash with W4
+#define CAHigh 14
+
+static inline int is_wild(int c) {
+   return c >= W4;
+}
+
+static inline int wildcard_rank(int c) {
+   if (c == W4) {
+      return 4;
+   } else if (c == W7) {
+      return 7;
+   } else if (c == WT) {
+      return 10;
+   } else if (c == WK) {
+      return 13;
+   } else {
+      return c;
+   }
+}
+
+
+static inline void handsort(int hnd[]) {
+   int i = 0;
+   int j = 0;
+   int swap = 0;
+   for (i = 0; i < 4; i++) {
+      swap = 0; // card is never 0
+      for (j = 0; j < 4 - i; j++) {
+         if (hnd[j] > hnd[j+1]) {
+            swap = hnd[j+1];
+            hnd[j+1] = hnd[j];
+            hnd[j] = swap;
+         }
+      }
+      if (!swap) {
+         break;
+      }
+   }
+}
+
+// hnd is sorted
+static inline int highcard(int hnd[], int wildcard_count) {
+   if (hnd[0] == CA) {
+      return CAHigh;
+   } else {
+      int highc = hnd[4];
+      if (highc >= W4) {
+        highc = wildcard_rank(highc);
+        // check if the highest non-wildcard is better
+        if (hnd[4 - wildcard_count] > highc) {
+          highc = hnd[4 - wildcard_count];
+        }
+      }
+      return highc;
+   }
+}
+
+static inline int score(int h0, int h1, int h2, int h3, int h4) {
+   int hnd[] = {h0, h1, h2, h3, h4};
+   handsort(hnd);
+
+   // find flush
+   int is_flush = 1; // assume true unless hnd has any wildcard
+
+   int lowest_wildcard = 0; // needed for run/Nkind detection
+   int second_lowest_wildcard = 0;
+   int wildcard_count = 0;
+   int i = 0;
+   for (i = 0; i < 5; i++) {
+      if (is_wild(hnd[i])) {
+        is_flush = 0;
+        lowest_wildcard = hnd[i];
+        if (i < 4) {
+         second_lowest_wildcard = hnd[i+1];
+        }
+        wildcard_count = 5 - i;
+        break;
+      }
+   }
+
+   // find 5,4,3 (of a kind), 2 (pair)
+   int run_length = 0;
+   int run_rank = 0;
+   if (lowest_wildcard) { // aka when not a flush
+    // can make at least wildcard_count of a kind with rank lowest_wildcard
+    // if there's a card lower or equal to lowest_wildcard there's a wildcard_count+1 of a kind
+    run_rank = wildcard_rank(lowest_wildcard);
+    for (i = 4 - wildcard_count; i >= 0; i--) { // high to low non-wildcards
+      if (hnd[i] <= run_rank) {
+         run_rank = hnd[i];
+         run_length = wildcard_count + 1;
+         break;
+      }
+    }
+    if (!run_length) { // no run found yet
+       // check if there is a card to make a better rank to replace the lowest_wildcard in the N of a kind
+       if (second_lowest_wildcard) {
+         run_rank = wildcard_rank(second_lowest_wildcard);
+         for (i = 4 - wildcard_count; i >= 0; i--) {
+            if (hnd[i] <= run_rank) {
+               run_rank = hnd[i];
+               run_length = wildcard_count;
+               break;
+            }
+         }
+       }
+       if (!run_length) {
+         run_rank = wildcard_rank(lowest_wildcard);
+         run_length = wildcard_count;
+       }
+    }
+   }
+
+   int straight_rank = 0;
+   if (is_flush) { // straight without wildcards is always a straight flush
+      if (hnd[0] == (hnd[4] - 4)) {
+         straight_rank = hnd[4];
+      } else if (hnd[0] == CA && hnd[1] == CT) {
+         straight_rank = CAHigh;
+      }
+   } else { // straight with wildcards
+     if (hnd[0] == CA) {
+       if ((lowest_wildcard == WT && hnd[1] >= CJ) ||
+           (lowest_wildcard == WK && hnd[1] >= CT)) {
+         straight_rank = CAHigh;
+       }
+     }
+     if (!straight_rank) {
+       int highest_suit_card = hnd[4 - wildcard_count];
+       if ((highest_suit_card - hnd[0]) <= 4) { // highest and lowest non-wildcard can form a straight
+         int straight_rank_low_bound = highest_suit_card >= 5 ? highest_suit_card : 5;
+         for (i = hnd[0] + 4; i >= straight_rank_low_bound; i--) {
+            // try all possible end ranks (from high to low) and see if the available wildcards can fill the gaps
+            int wanted_rank = i;
+            int wanted_rank_low = i - 4;
+            if (lowest_wildcard < wanted_rank_low) {
+               continue;
+            }
+            int suit_i = 4 - wildcard_count;
+            int wildcard_i = 4;
+            int wildcard_i_low_bound = suit_i + 1;
+            while (wanted_rank >= wanted_rank_low) {
+               if (wanted_rank == hnd[suit_i]) {
+                  if (suit_i > 0) {
+                     suit_i--;
+                  };
+               } else if (wanted_rank <= wildcard_rank(hnd[wildcard_i])) {
+                  if (wildcard_i > wildcard_i_low_bound) {
+                     wildcard_i--;
+                  };
+               } else {
+                  break; // no suit or wildcard to be the wanted_rank
+               }
+               wanted_rank--;
+            }
+            if (wanted_rank < wanted_rank_low) {
+               straight_rank = i;
+               break;
+            }
+         }
+       }
+     }
+   }
+   int combi = 0;
+   int highc = 0;
+
+   if (is_flush && (straight_rank == CAHigh)) {
+      combi = Royal;
+   } else if (run_length == 5) {
+      combi = FiveK;
+      highc = run_rank;
+   } else if (is_flush && straight_rank) {
+      combi = StrFl;
+      highc = straight_rank;
+   } else if (run_length == 4) {
+      combi = FourK;
+      highc = run_rank;
+   } else if (straight_rank) {
+      combi = Strgt;
+      highc = straight_rank;
+   } else if (is_flush) {
+      combi = Flush;
+      highc = highcard(hnd, 0);
+   } else if (run_length == 3) {
+      combi = Trips;
+      highc = run_rank;
+   } else if (run_length == 2) {
+      combi = OnePr;
+      highc = run_rank;
+   } else {
+      combi = HighC;
+      highc = highcard(hnd, wildcard_count);
+   }
+   return ((combi << 4) | highc) ;
+}
+
+// Branchless variant of score() on bit masks, no sort and no data dependent loops.
+// ranks has bit r set for each suit card of rank r (CA .. CK, bits 1..13),
+// wilds has bit 0..3 set for W4, W7, WT, WK (the card mask bits 14..17 shifted down).
+// Suit ranks are unique in the deck, so N of a kind comes from wildcards only.
+
+// max rank a wildcard can play as, by wilds bit, index 4 is no wildcard
+static const uint8_t WILD_MAX_RANK[5] = {4, 7, 10, 13, 0};
+
+// which value highc takes for a combi, 0 none, 1 run rank, 2 straight rank, 3 high card
+static const uint8_t COMBI_HIGHC_SOURCE[10] = {0, 3, 1, 1, 3, 2, 1, 2, 1, 0};
+
+// combi bit made by a run of length 0..5
+static const uint16_t RUN_COMBIS[6] = {0, 0, 1 << OnePr, 1 << Trips, 1 << FourK, 1 << FiveK};
+
+// suit rank bits 1..n
+#define RANKS_UPTO(n) ((2u << (n)) - 2u)
+#define RANKS_ABOVE(n) (RANKS_UPTO(CK) & ~RANKS_UPTO(n))
+
+// SWAR popcount of 16 bits, __builtin_popcount is a library call on the watch and without -mpopcnt
+static inline uint8_t popcount16(uint32_t x) {
+   x = x - ((x >> 1) & 0x5555);
+   x = (x & 0x3333) + ((x >> 2) & 0x3333);
+   x = (x + (x >> 4)) & 0x0F0F;
+   return (x + (x >> 8)) & 0x1F;
+}
+
+// the lowest and the highest set bit of x, not 0. __builtin_ctz and __builtin_clz are library calls on the
+// watch as well, the Cortex-M0+ has no CLZ: the bit alone times a de Bruijn sequence indexes its position
+static const uint8_t DEBRUIJN_BITS[32] = {0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+                                          31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9};
+
+static inline uint8_t lowest_bit(uint32_t x) {
+   return DEBRUIJN_BITS[((x & -x) * 0x077CB531u) >> 27];
+}
+
+static inline uint8_t highest_bit(uint32_t x) {
+   x |= x >> 1;
+   x |= x >> 2;
+   x |= x >> 4;
+   x |= x >> 8;
+   x |= x >> 16;
+   return DEBRUIJN_BITS[((x ^ (x >> 1)) * 0x077CB531u) >> 27];
+}
+
+// a when cond (0 or 1) else b, without a branch
+static inline uint8_t select_rank(uint8_t cond, uint8_t a, uint8_t b) {
+   return b ^ ((a ^ b) & -cond);
+}
+
+static inline uint8_t highest_rank(uint32_t ranks) {
+   return highest_bit(ranks | 1); // 0 for no ranks
+}
+
+// ranks of the 5 rank window ending at rank end that are above rank v
+#define WINDOW_ABOVE(end, v) ((end) - (v) < 0 ? 0 : ((end) - (v) > 5 ? 5 : (end) - (v)))
+
+// can the wildcards fill the ranks missing from the 5 rank window, which must hold all suit cards.
+// A missing rank r needs a wildcard with max rank >= r, with nested wildcard ranges it is enough that
+// above each wildcard max rank v the window has no more ranks than suit cards and wildcards above v (fill_above_v).
+static inline uint8_t straight_fits(uint32_t window, uint8_t above10, uint8_t above7, uint8_t above4,
+                                    uint16_t ranks, uint8_t fill_above10, uint8_t fill_above7, uint8_t fill_above4) {
+   return ((ranks & ~window) == 0) & (above10 <= fill_above10) & (above7 <= fill_above7) & (above4 <= fill_above4);
+}
+
+static inline int score_bits(uint16_t ranks, uint8_t wilds) {
+   uint8_t wildcard_count = popcount16(wilds);
+   uint8_t is_flush = wildcard_count == 0;
+
+   // N of a kind: all wildcards play as the highest suit card the lowest wildcard can be,
+   // else all but the lowest wildcard play as one the second lowest can be, else all play as the lowest
+   uint8_t lowest_rank = WILD_MAX_RANK[lowest_bit(wilds | 0x10)];
+   uint8_t second_lowest_rank = WILD_MAX_RANK[lowest_bit((wilds & (wilds - 1)) | 0x10)];
+   uint8_t lowest_run = highest_rank(ranks & RANKS_UPTO(lowest_rank));
+   uint8_t second_lowest_run = highest_rank(ranks & RANKS_UPTO(second_lowest_rank));
+   uint8_t run_length = wildcard_count + (lowest_run != 0);
+   uint8_t run_rank = select_rank(lowest_run != 0, lowest_run, select_rank(second_lowest_run != 0, second_lowest_run, lowest_rank));
+
+   // straights: windows ending at 5 .. CK and the ace high window T J Q K A
+   uint8_t fill_above10 = popcount16(ranks & RANKS_ABOVE(10)) + (wilds >> 3);
+   uint8_t fill_above7 = popcount16(ranks & RANKS_ABOVE(7)) + popcount16(wilds & 0xC);
+   uint8_t fill_above4 = popcount16(ranks & RANKS_ABOVE(4)) + popcount16(wilds & 0xE);
+   uint32_t straights = 0;
+   for (int8_t i = 5; i <= CK; i++) {
+      straights |= (uint32_t) straight_fits(0x1F << (i - 4), WINDOW_ABOVE(i, 10), WINDOW_ABOVE(i, 7), WINDOW_ABOVE(i, 4),
+                                            ranks, fill_above10, fill_above7, fill_above4) << i;
+   }
+   straights |= (uint32_t) (straight_fits(RANKS_ABOVE(9) | (1 << CA), 3, 4, 4,
+                                          ranks, fill_above10, fill_above7, fill_above4) & (ranks >> CA)) << CAHigh;
+   uint8_t straight_rank = highest_rank(straights);
+
+   uint8_t high_rank = highest_rank(ranks);
+   uint8_t high_wildcard = WILD_MAX_RANK[highest_bit(wilds | 1) | (is_flush << 2)];
+   uint8_t highc_high = select_rank((ranks >> CA) & 1, CAHigh, select_rank(high_rank > high_wildcard, high_rank, high_wildcard));
+
+   uint16_t combis = (1 << HighC) | RUN_COMBIS[run_length] |
+      (is_flush << Flush) |
+      ((straight_rank != 0) << Strgt) |
+      ((is_flush & (straight_rank != 0)) << StrFl) |
+      ((is_flush & (straight_rank == CAHigh)) << Royal);
+   uint8_t combi = highest_bit(combis);
+
+   const uint8_t highcs[4] = {0, run_rank, straight_rank, highc_high};
+   return (combi << 4) | highcs[COMBI_HIGHC_SOURCE[combi]];
+}
+
+static inline int score_mask(uint32_t mask) {
+   return score_bits(mask & RANKS_UPTO(CK), mask >> W4);
+}
+
+// Hands as 17 bit card masks, card c is bit c (bit 0 unused) as in state->dealt.
+// A 5 card mask has a colexicographic rank 0 <= rank < HAND_COUNT, counting the masks in increasing order.
+#define HAND_COUNT 6188
+
+// HAND_BINOM[n][k] is C(n, k)
+static const uint16_t HAND_BINOM[18][6] = {
+    {   1,    0,    0,    0,    0,    0},
+    {   1,    1,    0,    0,    0,    0},
+    {   1,    2,    1,    0,    0,    0},
+    {   1,    3,    3,    1,    0,    0},
+    {   1,    4,    6,    4,    1,    0},
+    {   1,    5,   10,   10,    5,    1},
+    {   1,    6,   15,   20,   15,    6},
+    {   1,    7,   21,   35,   35,   21},
+    {   1,    8,   28,   56,   70,   56},
+    {   1,    9,   36,   84,  126,  126},
+    {   1,   10,   45,  120,  210,  252},
+    {   1,   11,   55,  165,  330,  462},
+    {   1,   12,   66,  220,  495,  792},
+    {   1,   13,   78,  286,  715, 1287},
+    {   1,   14,   91,  364, 1001, 2002},
+    {   1,   15,  105,  455, 1365, 3003},
+    {   1,   16,  120,  560, 1820, 4368},
+    {   1,   17,  136,  680, 2380, 6188},
+};
+
+static inline uint32_t hand_mask(const uint8_t hnd[5]) {
+    return (1 << hnd[0]) | (1 << hnd[1]) | (1 << hnd[2]) | (1 << hnd[3]) | (1 << hnd[4]);
+}
+
+static inline uint16_t hand_rank(uint32_t mask) {
+    uint16_t rank = 0;
+    mask >>= 1;
+    for (uint8_t k = 1; k <= 5; k++) {
+        rank += HAND_BINOM[lowest_bit(mask)][k];
+        mask &= mask - 1;
+    }
+    return rank;
+}
+
+static inline uint32_t hand_unrank(uint16_t rank) {
+    uint32_t mask = 0;
+    uint8_t n = 17;
+    for (uint8_t k = 5; k >= 1; k--) {
+        do {
+            n--;
+        } while (HAND_BINOM[n][k] > rank);
+        rank -= HAND_BINOM[n][k];
+        mask |= 1 << (n + 1);
+    }
+    return mask;
+}
+
+#endif // bird_poker_SCORE_H_
@@ -0,0 +1,403 @@
+#ifndef bird_poker_SCORE_TABLE_H_
+#define bird_poker_SCORE_TABLE_H_
+
+// Generated by tools/gen_score_table.c, do not edit.
+// SCORE_TABLE[hand_rank(mask)] is score() of the 5 card hand mask, check with tools/gen_score_table -c
+
+#include "bird_poker_score.h"
+
+static const uint8_t SCORE_TABLE[HAND_COUNT] = {
+    0x75, 0x4e, 0x4e, 0x4e, 0x4e, 0x76, 0x4e, 0x4e, 0x4e, 0x4e, 0x47, 0x4e, 0x4e, 0x4e, 0x47, 0x4e,
+    0x4e, 0x47, 0x4e, 0x47, 0x77, 0x4e, 0x4e, 0x4e, 0x4e, 0x48, 0x4e, 0x4e, 0x4e, 0x48, 0x4e, 0x4e,
+    0x48, 0x4e, 0x48, 0x48, 0x4e, 0x4e, 0x4e, 0x48, 0x4e, 0x4e, 0x48, 0x4e, 0x48, 0x48, 0x4e, 0x4e,
+    0x48, 0x4e, 0x48, 0x48, 0x4e, 0x48, 0x48, 0x78, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x4e,
+    0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49,
+    0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x49, 0x4e,
+    0x4e, 0x49, 0x4e, 0x49, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x4e,
+    0x4e, 0x49, 0x4e, 0x49, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x79, 0x4e, 0x4e,
+    0x4e, 0x4e, 0x4a, 0x4e, 0x4e, 0x4e, 0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4e, 0x4e,
+    0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4a, 0x4a,
+    0x4a, 0x4e, 0x4e, 0x4e, 0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a,
+    0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4e,
+    0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x4e, 0x4e, 0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4e,
+    0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4a,
+    0x4a, 0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4e, 0x4a, 0x4a,
+    0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x7a, 0x4e, 0x4e, 0x4e, 0x4e,
+    0x4b, 0x4e, 0x4e, 0x4e, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4e, 0x4e, 0x4b, 0x4e,
+    0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e,
+    0x4e, 0x4e, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e,
+    0x4b, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b,
+    0x4b, 0x4b, 0x4e, 0x4e, 0x4e, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e,
+    0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b,
+    0x4e, 0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e,
+    0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4e, 0x4e, 0x4b, 0x4e, 0x4e,
+    0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x4e,
+    0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b,
+    0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b,
+    0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b,
+    0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x7b, 0x4e, 0x4e,
+    0x4e, 0x4e, 0x4c, 0x4e, 0x4e, 0x4e, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4e, 0x4e,
+    0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c,
+    0x4c, 0x4e, 0x4e, 0x4e, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c,
+    0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4e, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4e,
+    0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c,
+    0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c,
+    0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4e, 0x4c,
+    0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c,
+    0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e,
+    0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4e, 0x4e, 0x4e, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c,
+    0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c,
+    0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x7c, 0x4e, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e,
+    0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d,
+    0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e,
+    0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e,
+    0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e,
+    0x4e, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d,
+    0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d,
+    0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d,
+    0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d,
+    0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d,
+    0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e,
+    0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e,
+    0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d,
+    0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e,
+    0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e,
+    0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d,
+    0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d,
+    0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d,
+    0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e,
+    0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d,
+    0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+    0x4d, 0x4d, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e,
+    0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d,
+    0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e,
+    0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d,
+    0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e,
+    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d,
+    0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d,
+    0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4d,
+    0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e,
+    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x90, 0x4d,
+    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x7d, 0x24, 0x55, 0x55, 0x55, 0x55, 0x23, 0x24, 0x24, 0x24,
+    0x22, 0x23, 0x56, 0x24, 0x56, 0x56, 0x23, 0x24, 0x24, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24,
+    0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x57, 0x57, 0x23, 0x24, 0x24, 0x24, 0x22, 0x23,
+    0x23, 0x24, 0x24, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x22, 0x23,
+    0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x58, 0x23, 0x24, 0x24,
+    0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23,
+    0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x19,
+    0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x19, 0x21,
+    0x22, 0x23, 0x24, 0x19, 0x19, 0x23, 0x24, 0x24, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x22,
+    0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21,
+    0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1a, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22,
+    0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1a, 0x21, 0x22, 0x23, 0x24, 0x1a, 0x1a, 0x22, 0x23, 0x23,
+    0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1a, 0x21, 0x22, 0x23, 0x24,
+    0x1a, 0x1a, 0x21, 0x22, 0x23, 0x24, 0x1a, 0x1a, 0x1a, 0x23, 0x24, 0x24, 0x24, 0x22, 0x23, 0x23,
+    0x24, 0x24, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x22, 0x23, 0x23,
+    0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1b, 0x22, 0x23, 0x23, 0x24,
+    0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1b, 0x21, 0x22, 0x23, 0x24, 0x1b,
+    0x1b, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1b,
+    0x21, 0x22, 0x23, 0x24, 0x1b, 0x1b, 0x21, 0x22, 0x23, 0x24, 0x1b, 0x1b, 0x1b, 0x22, 0x23, 0x23,
+    0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1b, 0x21, 0x22, 0x23, 0x24,
+    0x1b, 0x1b, 0x21, 0x22, 0x23, 0x24, 0x1b, 0x1b, 0x1b, 0x21, 0x22, 0x23, 0x24, 0x1b, 0x1b, 0x1b,
+    0x1b, 0x23, 0x24, 0x24, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24,
+    0x24, 0x21, 0x22, 0x23, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21,
+    0x22, 0x23, 0x24, 0x1c, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22,
+    0x23, 0x24, 0x1c, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x1c, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21,
+    0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x1c, 0x21, 0x22,
+    0x23, 0x24, 0x1c, 0x1c, 0x1c, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21,
+    0x22, 0x23, 0x24, 0x1c, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x1c, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x1c,
+    0x1c, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x1c, 0x1c, 0x1c, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21,
+    0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x1c, 0x21, 0x22,
+    0x23, 0x24, 0x1c, 0x1c, 0x1c, 0x21, 0x22, 0x23, 0x24, 0x1c, 0x1c, 0x1c, 0x1c, 0x21, 0x22, 0x23,
+    0x24, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x23, 0x24, 0x24, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24,
+    0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24,
+    0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x21,
+    0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x22, 0x23,
+    0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x21, 0x22, 0x23,
+    0x24, 0x1d, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24,
+    0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x21,
+    0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x1d, 0x22, 0x23,
+    0x23, 0x24, 0x24, 0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x21, 0x22, 0x23,
+    0x24, 0x1d, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d,
+    0x1d, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x22, 0x23, 0x23, 0x24, 0x24,
+    0x24, 0x21, 0x22, 0x23, 0x24, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d,
+    0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x1d, 0x21,
+    0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x1d, 0x1d, 0x1d, 0x1d,
+    0x1d, 0x1d, 0x55, 0x55, 0x55, 0x55, 0x56, 0x26, 0x26, 0x26, 0x56, 0x26, 0x26, 0x56, 0x26, 0x56,
+    0x57, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x57, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x57, 0x27, 0x27, 0x57, 0x57, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x58, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x58, 0x27, 0x27, 0x27, 0x58, 0x58, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24,
+    0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x59, 0x27, 0x27, 0x27, 0x27, 0x59, 0x59,
+    0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25,
+    0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x5a, 0x5a, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25,
+    0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x23, 0x23, 0x24,
+    0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25,
+    0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x5b, 0x23, 0x24, 0x24, 0x24,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22,
+    0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x21, 0x22, 0x23, 0x24,
+    0x25, 0x26, 0x27, 0x1c, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x1c, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x1c,
+    0x1c, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25,
+    0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22,
+    0x23, 0x24, 0x25, 0x26, 0x27, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+    0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x1d, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25,
+    0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22,
+    0x23, 0x24, 0x25, 0x26, 0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x1d, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x1d, 0x1d, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x22, 0x23, 0x24, 0x25,
+    0x26, 0x27, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+    0x27, 0x1d, 0x1d, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x1d, 0x1d, 0x1d, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x32, 0x33, 0x56, 0x34, 0x56, 0x56, 0x31, 0x56, 0x57,
+    0x57, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x57, 0x57, 0x31, 0x32, 0x57, 0x57, 0x57,
+    0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x58, 0x31,
+    0x32, 0x33, 0x34, 0x58, 0x58, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31,
+    0x32, 0x33, 0x34, 0x26, 0x31, 0x32, 0x33, 0x34, 0x27, 0x27, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26,
+    0x27, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x26,
+    0x31, 0x32, 0x33, 0x34, 0x27, 0x27, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x31, 0x32, 0x33,
+    0x34, 0x25, 0x26, 0x27, 0x24, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31,
+    0x32, 0x33, 0x34, 0x26, 0x31, 0x32, 0x33, 0x34, 0x27, 0x27, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26,
+    0x27, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x24, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27,
+    0x24, 0x24, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34,
+    0x26, 0x31, 0x32, 0x33, 0x34, 0x27, 0x27, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x31, 0x32,
+    0x33, 0x34, 0x25, 0x26, 0x27, 0x24, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x24, 0x24, 0x31,
+    0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x24, 0x24, 0x24, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31,
+    0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x26, 0x31, 0x32, 0x33, 0x34, 0x27, 0x27, 0x31, 0x32,
+    0x33, 0x34, 0x25, 0x26, 0x27, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x24, 0x31, 0x32, 0x33,
+    0x34, 0x25, 0x26, 0x27, 0x24, 0x24, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x24, 0x24, 0x24,
+    0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x24, 0x24, 0x24, 0x24, 0x55, 0x55, 0x55, 0x55, 0x56,
+    0x26, 0x26, 0x26, 0x56, 0x26, 0x26, 0x56, 0x26, 0x56, 0x57, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x57, 0x27, 0x27, 0x27, 0x27, 0x27, 0x57, 0x27, 0x27, 0x57, 0x58, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x58, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x58, 0x28, 0x28, 0x28, 0x58,
+    0x59, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x59, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x59, 0x29, 0x29, 0x29, 0x29, 0x59, 0x5a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x5a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x5a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x5a, 0x5a, 0x23, 0x24, 0x24,
+    0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x5b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x5b, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x5b, 0x5b, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x22, 0x23, 0x23,
+    0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x5c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x5c, 0x5c, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x22, 0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x22,
+    0x23, 0x23, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x5e, 0x22, 0x23, 0x24,
+    0x25, 0x26, 0x27, 0x28, 0x5d, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56,
+    0x32, 0x33, 0x56, 0x34, 0x56, 0x56, 0x31, 0x56, 0x57, 0x57, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34,
+    0x31, 0x32, 0x57, 0x57, 0x31, 0x32, 0x57, 0x57, 0x58, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31,
+    0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x58, 0x31, 0x32, 0x33, 0x34, 0x58, 0x58, 0x32, 0x33,
+    0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x29, 0x31, 0x32, 0x33,
+    0x34, 0x29, 0x29, 0x31, 0x32, 0x33, 0x34, 0x29, 0x29, 0x29, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34,
+    0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x2a, 0x31, 0x32, 0x33, 0x34, 0x2a, 0x2a, 0x31,
+    0x32, 0x33, 0x34, 0x2a, 0x2a, 0x2a, 0x31, 0x32, 0x33, 0x34, 0x2a, 0x2a, 0x2a, 0x2a, 0x32, 0x33,
+    0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x26, 0x31, 0x32, 0x33,
+    0x34, 0x27, 0x27, 0x31, 0x32, 0x33, 0x34, 0x28, 0x28, 0x28, 0x31, 0x32, 0x33, 0x34, 0x29, 0x29,
+    0x29, 0x29, 0x31, 0x32, 0x33, 0x34, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x32, 0x33, 0x33, 0x34, 0x34,
+    0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x26, 0x31, 0x32, 0x33, 0x34, 0x27, 0x27,
+    0x31, 0x32, 0x33, 0x34, 0x28, 0x28, 0x28, 0x31, 0x32, 0x33, 0x34, 0x29, 0x29, 0x29, 0x29, 0x31,
+    0x32, 0x33, 0x34, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34,
+    0x26, 0x31, 0x32, 0x33, 0x34, 0x27, 0x27, 0x31, 0x32, 0x33, 0x34, 0x28, 0x28, 0x28, 0x31, 0x32,
+    0x33, 0x34, 0x29, 0x29, 0x29, 0x29, 0x31, 0x32, 0x33, 0x34, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x31,
+    0x32, 0x33, 0x34, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x31, 0x32, 0x33, 0x34, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x24, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56, 0x55, 0x56, 0x57, 0x36, 0x36,
+    0x56, 0x36, 0x56, 0x57, 0x36, 0x56, 0x57, 0x58, 0x37, 0x37, 0x37, 0x37, 0x37, 0x57, 0x37, 0x37,
+    0x57, 0x58, 0x37, 0x37, 0x57, 0x58, 0x58, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35,
+    0x58, 0x36, 0x36, 0x36, 0x58, 0x59, 0x37, 0x37, 0x37, 0x58, 0x59, 0x59, 0x32, 0x33, 0x33, 0x34,
+    0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x59, 0x37, 0x37, 0x37, 0x37, 0x59,
+    0x59, 0x31, 0x32, 0x33, 0x34, 0x59, 0x5a, 0x5a, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35, 0x35,
+    0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x5a, 0x5a, 0x31, 0x32, 0x33, 0x34, 0x35, 0x5a, 0x5a, 0x5a, 0x32, 0x33, 0x33, 0x34,
+    0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x5b,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x5b, 0x5b, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35,
+    0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x29, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x2a, 0x2a, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x28, 0x29, 0x2a,
+    0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x29, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x2a, 0x2a, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x28, 0x29, 0x2a, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x28, 0x29,
+    0x2a, 0x27, 0x62, 0x63, 0x63, 0x64, 0x64, 0x64, 0x61, 0x62, 0x63, 0x64, 0x61, 0x62, 0x63, 0x64,
+    0x58, 0x61, 0x62, 0x63, 0x64, 0x58, 0x58, 0x61, 0x62, 0x63, 0x64, 0x58, 0x58, 0x58, 0x61, 0x62,
+    0x63, 0x64, 0x35, 0x36, 0x37, 0x34, 0x61, 0x62, 0x63, 0x64, 0x35, 0x36, 0x37, 0x34, 0x34, 0x61,
+    0x62, 0x63, 0x64, 0x35, 0x36, 0x37, 0x34, 0x34, 0x34, 0x61, 0x62, 0x63, 0x64, 0x35, 0x36, 0x37,
+    0x34, 0x34, 0x34, 0x34, 0x61, 0x62, 0x63, 0x64, 0x35, 0x36, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x55, 0x55, 0x55, 0x55, 0x56, 0x26, 0x26, 0x26, 0x56, 0x26, 0x26, 0x56, 0x26, 0x56, 0x57, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x57, 0x27, 0x27, 0x27, 0x27, 0x27, 0x57, 0x27,
+    0x27, 0x57, 0x58, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x58, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x58, 0x28, 0x28, 0x28, 0x58, 0x59, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x59, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x59, 0x29, 0x29, 0x29, 0x29, 0x59, 0x5a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x5a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x5a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x5a, 0x5b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x5b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x2b, 0x5b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x5b, 0x5c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x5c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x5c, 0x5e, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x5c, 0x5d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x5e, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x5d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x5e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x5d, 0x5e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x5d, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x56, 0x55, 0x56, 0x56, 0x32, 0x33, 0x56, 0x34, 0x56, 0x56, 0x31, 0x56, 0x57, 0x57, 0x32,
+    0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x57, 0x57, 0x31, 0x32, 0x57, 0x57, 0x58, 0x32, 0x33,
+    0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x58, 0x31, 0x32, 0x33,
+    0x34, 0x58, 0x58, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33,
+    0x34, 0x29, 0x31, 0x32, 0x33, 0x34, 0x29, 0x29, 0x31, 0x32, 0x33, 0x34, 0x29, 0x29, 0x29, 0x32,
+    0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x2a, 0x31, 0x32,
+    0x33, 0x34, 0x2a, 0x2a, 0x31, 0x32, 0x33, 0x34, 0x2a, 0x2a, 0x2a, 0x31, 0x32, 0x33, 0x34, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33,
+    0x34, 0x2b, 0x31, 0x32, 0x33, 0x34, 0x2b, 0x2b, 0x31, 0x32, 0x33, 0x34, 0x2b, 0x2b, 0x2b, 0x31,
+    0x32, 0x33, 0x34, 0x2b, 0x2b, 0x2b, 0x2b, 0x31, 0x32, 0x33, 0x34, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+    0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33, 0x34, 0x31, 0x32, 0x33, 0x34, 0x2c, 0x31,
+    0x32, 0x33, 0x34, 0x2c, 0x2c, 0x31, 0x32, 0x33, 0x34, 0x2c, 0x2c, 0x2c, 0x31, 0x32, 0x33, 0x34,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x31, 0x32, 0x33, 0x34, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x31, 0x32, 0x33,
+    0x34, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x32, 0x33,
+    0x34, 0x31, 0x32, 0x33, 0x34, 0x2d, 0x31, 0x32, 0x33, 0x34, 0x2d, 0x2d, 0x31, 0x32, 0x33, 0x34,
+    0x2d, 0x2d, 0x2d, 0x31, 0x32, 0x33, 0x34, 0x2d, 0x2d, 0x2d, 0x2d, 0x31, 0x32, 0x33, 0x34, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x31, 0x32, 0x33, 0x34, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x31, 0x32,
+    0x33, 0x34, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56,
+    0x55, 0x56, 0x57, 0x36, 0x36, 0x56, 0x36, 0x56, 0x57, 0x36, 0x56, 0x57, 0x58, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x57, 0x37, 0x37, 0x57, 0x58, 0x37, 0x37, 0x57, 0x58, 0x58, 0x32, 0x33, 0x33, 0x34,
+    0x34, 0x34, 0x35, 0x35, 0x35, 0x58, 0x36, 0x36, 0x36, 0x58, 0x59, 0x37, 0x37, 0x37, 0x58, 0x59,
+    0x59, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x59,
+    0x37, 0x37, 0x37, 0x37, 0x59, 0x59, 0x31, 0x32, 0x33, 0x34, 0x59, 0x5a, 0x5a, 0x32, 0x33, 0x33,
+    0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x5a, 0x5a, 0x31, 0x32, 0x33, 0x34, 0x35, 0x5a, 0x5a,
+    0x5b, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x5b, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x5b, 0x5b, 0x32, 0x33,
+    0x33, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x2c, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x2c, 0x2c, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x2c, 0x2c, 0x2c, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36,
+    0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x2d, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x2d, 0x2d, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x2d, 0x2d, 0x2d, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x2d, 0x2d, 0x2d, 0x2d, 0x62, 0x63, 0x63, 0x64, 0x64, 0x64, 0x61, 0x62, 0x63,
+    0x64, 0x61, 0x62, 0x63, 0x64, 0x58, 0x61, 0x62, 0x63, 0x64, 0x58, 0x58, 0x61, 0x62, 0x63, 0x64,
+    0x58, 0x58, 0x58, 0x61, 0x62, 0x63, 0x64, 0x35, 0x36, 0x37, 0x34, 0x61, 0x62, 0x63, 0x64, 0x35,
+    0x36, 0x37, 0x34, 0x34, 0x61, 0x62, 0x63, 0x64, 0x35, 0x36, 0x37, 0x34, 0x34, 0x34, 0x61, 0x62,
+    0x63, 0x64, 0x35, 0x36, 0x37, 0x34, 0x34, 0x34, 0x34, 0x61, 0x62, 0x63, 0x64, 0x35, 0x36, 0x37,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56, 0x55, 0x56, 0x57, 0x36,
+    0x36, 0x56, 0x36, 0x56, 0x57, 0x36, 0x56, 0x57, 0x58, 0x37, 0x37, 0x37, 0x37, 0x37, 0x57, 0x37,
+    0x37, 0x57, 0x58, 0x37, 0x37, 0x57, 0x58, 0x59, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x58, 0x38, 0x38, 0x38, 0x58, 0x59, 0x38, 0x38, 0x38, 0x58, 0x59, 0x5a, 0x39, 0x39, 0x39,
+    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x59, 0x39, 0x39, 0x39, 0x39,
+    0x59, 0x5a, 0x39, 0x39, 0x39, 0x39, 0x59, 0x5a, 0x5b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+    0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x5a, 0x3a, 0x3a,
+    0x3a, 0x3a, 0x3a, 0x5a, 0x5b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x5a, 0x5b, 0x5b, 0x32, 0x33, 0x33,
+    0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x5b, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x5b,
+    0x5c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x5b, 0x5c, 0x5c, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34,
+    0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x5c, 0x3a, 0x3a,
+    0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x5c, 0x5c, 0x5e, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x5c, 0x5d,
+    0x5d, 0x32, 0x33, 0x33, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x39, 0x39,
+    0x39, 0x39, 0x39, 0x39, 0x39, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x5e, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x5d, 0x5d, 0x5e, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x5d, 0x5d, 0x5d, 0x62, 0x63, 0x63, 0x64, 0x64, 0x64, 0x61, 0x62, 0x63, 0x64, 0x61, 0x62, 0x63,
+    0x64, 0x58, 0x61, 0x62, 0x63, 0x64, 0x58, 0x58, 0x61, 0x62, 0x63, 0x64, 0x58, 0x58, 0x58, 0x61,
+    0x62, 0x63, 0x64, 0x39, 0x39, 0x39, 0x39, 0x61, 0x62, 0x63, 0x64, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+    0x61, 0x62, 0x63, 0x64, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x61, 0x62, 0x63, 0x64, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x3a, 0x34, 0x61, 0x62, 0x63, 0x64, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x34,
+    0x34, 0x62, 0x63, 0x63, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x5b, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x5b, 0x5b, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x5b, 0x5b, 0x5b, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x38,
+    0x39, 0x3a, 0x37, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x38, 0x39, 0x3a, 0x37, 0x37, 0x81,
+    0x82, 0x83, 0x84, 0x65, 0x66, 0x67, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+};
+
+static inline uint8_t score_lookup(uint32_t mask) {
+    return SCORE_TABLE[hand_rank(mask)];
+}
+
+#endif // bird_poker_SCORE_TABLE_H_
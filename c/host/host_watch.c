@@ -0,0 +1,175 @@
+// Host stand-ins for the Sensor Watch display and Movement calls, drawing into host_watch.pixels.
+#include <string.h>
+#include "host_watch.h"
+#include "watch_private_display.h"
+
+host_watch_t host_watch = {.tick_frequency = 1, .backup_claimed = 4};
+
+static uint64_t rng_state = 0x853C49E6748FEA9Bull;
+static const char *backup_path;
+
+void host_watch_seed(uint64_t seed) {
+    rng_state = seed ? seed : 0x853C49E6748FEA9Bull;
+}
+
+void host_watch_backup_file(const char *path) {
+    backup_path = path;
+    FILE *f = path ? fopen(path, "rb") : NULL;
+    if (f) {
+        if (fread(host_watch.backup, sizeof(host_watch.backup), 1, f) != 1) {
+            memset(host_watch.backup, 0, sizeof(host_watch.backup));
+        }
+        fclose(f);
+    }
+}
+
+// xorshift64*
+uint32_t arc4random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (rng_state * 0x2545F4914F6CDD1Dull) >> 32;
+}
+
+// rejection for an unbiased bound
+uint32_t arc4random_uniform(uint32_t upper_bound) {
+    if (upper_bound < 2) {
+        return 0;
+    }
+    uint32_t threshold = -upper_bound % upper_bound;
+    for (;;) {
+        uint32_t r = arc4random();
+        if (r >= threshold) {
+            return r % upper_bound;
+        }
+    }
+}
+
+void watch_set_pixel(uint8_t com, uint8_t seg) {
+    host_watch.pixels[com] |= 1u << seg;
+    host_watch.pixel_writes++;
+}
+
+void watch_clear_pixel(uint8_t com, uint8_t seg) {
+    host_watch.pixels[com] &= ~(1u << seg);
+    host_watch.pixel_writes++;
+}
+
+void watch_clear_display(void) {
+    host_watch.pixels[0] = 0;
+    host_watch.pixels[1] = 0;
+    host_watch.pixels[2] = 0;
+    host_watch.clears++;
+}
+
+void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
+    if (position >= Num_Chars) {
+        return;
+    }
+    uint8_t glyph = (character >= 0x20 && character < 0x80) ? Character_Set[character - 0x20] : 0;
+    uint64_t segmap = Segment_Map[position];
+    // joined segments are written twice, as on the watch
+    for (uint8_t i = 0; i < 8; i++, segmap >>= 8) {
+        uint8_t com = (segmap & 0xFF) >> 6;
+        if (com > 2) {
+            continue;
+        }
+        if (glyph & (1 << i)) {
+            watch_set_pixel(com, segmap & 0x3F);
+        } else {
+            watch_clear_pixel(com, segmap & 0x3F);
+        }
+    }
+}
+
+// no per position character replacements on the host
+void watch_display_character(uint8_t character, uint8_t position) {
+    watch_display_character_lp_seconds(character, position);
+}
+
+void watch_display_string(char *string, uint8_t position) {
+    for (size_t i = 0; string[i] != 0 && position + i < Num_Chars; i++) {
+        watch_display_character(string[i], position + i);
+    }
+}
+
+void watch_set_colon(void) {
+    watch_set_pixel(1, 16);
+}
+
+void watch_clear_colon(void) {
+    watch_clear_pixel(1, 16);
+}
+
+// written through to the backup file, as a reset may come at any time
+void watch_store_backup_data(uint32_t data, uint8_t reg) {
+    if (reg >= 8) {
+        return;
+    }
+    host_watch.backup[reg] = data;
+    host_watch.backup_writes++;
+    FILE *f = backup_path ? fopen(backup_path, "wb") : NULL;
+    if (f) {
+        fwrite(host_watch.backup, sizeof(host_watch.backup), 1, f);
+        fclose(f);
+    }
+}
+
+uint32_t watch_get_backup_data(uint8_t reg) {
+    return reg < 8 ? host_watch.backup[reg] : 0;
+}
+
+void movement_request_tick_frequency(uint8_t freq) {
+    host_watch.tick_frequency_requests++;
+    if (freq != host_watch.tick_frequency) {
+        host_watch.tick_frequency_changes++;
+        host_watch.tick_frequency = freq;
+    }
+}
+
+bool movement_default_loop_handler(movement_event_t event, movement_settings_t *settings) {
+    (void) event;
+    (void) settings;
+    return true;
+}
+
+void movement_move_to_face(uint8_t watch_face_index) {
+    (void) watch_face_index;
+}
+
+void movement_illuminate_led(void) {
+}
+
+// 0 to 3 are Movement's own, as on the watch
+uint8_t movement_claim_backup_register(void) {
+    if (host_watch.backup_claimed >= 8) {
+        return 0;
+    }
+    return host_watch.backup_claimed++;
+}
+
+static int lit(uint8_t position, uint8_t segment) {
+    uint8_t px = Segment_Map[position] >> (8 * segment);
+    return (px >> 6) <= 2 && (host_watch.pixels[px >> 6] & (1u << (px & 0x3F)));
+}
+
+void host_watch_print(FILE *out) {
+    static const uint8_t rows[2][6] = {{0, 1, 2, 3}, {4, 5, 6, 7, 8, 9}};
+    static const uint8_t row_lengths[2] = {4, 6};
+    for (int row = 0; row < 2; row++) {
+        for (int line = 0; line < 3; line++) {
+            fputs(row ? "" : "   ", out);
+            for (int i = 0; i < row_lengths[row]; i++) {
+                uint8_t p = rows[row][i];
+                if (line == 0) {
+                    fprintf(out, " %c  ", lit(p, 0) ? '_' : ' ');
+                } else if (line == 1) {
+                    fprintf(out, "%c%c%c ", lit(p, 5) ? '|' : ' ', lit(p, 6) ? '_' : ' ', lit(p, 1) ? '|' : ' ');
+                } else {
+                    fprintf(out, "%c%c%c ", lit(p, 4) ? '|' : ' ', lit(p, 3) ? '_' : ' ', lit(p, 2) ? '|' : ' ');
+                }
+            }
+            fputc('\n', out);
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef HOST_WATCH_H_
+#define HOST_WATCH_H_
+
+// Host side of the watch.h and movement.h stand-ins: the LCD framebuffer and counters for harnesses.
+
+#include "movement.h"
+
+typedef struct {
+    uint32_t pixels[3];              // bit seg of pixels[com] is lit
+    uint64_t pixel_writes;           // pixel set/clear calls, and one per segment written by a character
+    uint64_t clears;                 // watch_clear_display calls
+    uint64_t tick_frequency_requests;
+    uint64_t tick_frequency_changes; // requests for another frequency than the current one
+    uint8_t tick_frequency;
+    uint32_t backup[8];              // the backup registers
+    uint64_t backup_writes;          // watch_store_backup_data calls
+    uint8_t backup_claimed;          // the next register movement_claim_backup_register gives
+} host_watch_t;
+
+extern host_watch_t host_watch;
+
+// reseeds the arc4random stand-ins, the face seeds its card stream from them at setup,
+// so the same seed replays the same cards
+void host_watch_seed(uint64_t seed);
+
+// keeps the backup registers in the file at path, loading them from it when it exists: a later run (a reset)
+// finds what an earlier one stored; NULL keeps them in memory only
+void host_watch_backup_file(const char *path);
+
+// draws the 10 character positions, top row 0 to 3 and bottom row 4 to 9
+void host_watch_print(FILE *out);
+
+#endif // HOST_WATCH_H_
@@ -0,0 +1,59 @@
+#ifndef MOVEMENT_H_
+#define MOVEMENT_H_
+
+// Host stand-in for Sensor Watch's movement.h, only what the faces here use.
+
+#include "watch.h"
+
+typedef union {
+    uint32_t reg;
+} movement_settings_t;
+
+typedef enum {
+    EVENT_NONE = 0,
+    EVENT_ACTIVATE,
+    EVENT_TICK,
+    EVENT_LOW_ENERGY_UPDATE,
+    EVENT_BACKGROUND_TASK,
+    EVENT_TIMEOUT,
+    EVENT_LIGHT_BUTTON_DOWN,
+    EVENT_LIGHT_BUTTON_UP,
+    EVENT_LIGHT_LONG_PRESS,
+    EVENT_LIGHT_LONG_UP,
+    EVENT_MODE_BUTTON_DOWN,
+    EVENT_MODE_BUTTON_UP,
+    EVENT_MODE_LONG_PRESS,
+    EVENT_MODE_LONG_UP,
+    EVENT_ALARM_BUTTON_DOWN,
+    EVENT_ALARM_BUTTON_UP,
+    EVENT_ALARM_LONG_PRESS,
+    EVENT_ALARM_LONG_UP,
+} movement_event_type_t;
+
+typedef struct {
+    uint8_t event_type;
+    uint8_t subsecond;
+} movement_event_t;
+
+typedef void (*watch_face_setup)(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+typedef void (*watch_face_activate)(movement_settings_t *settings, void *context);
+typedef bool (*watch_face_loop)(movement_event_t event, movement_settings_t *settings, void *context);
+typedef void (*watch_face_resign)(movement_settings_t *settings, void *context);
+typedef bool (*watch_face_wants_background_task)(movement_settings_t *settings, void *context);
+
+typedef struct {
+    watch_face_setup setup;
+    watch_face_activate activate;
+    watch_face_loop loop;
+    watch_face_resign resign;
+    watch_face_wants_background_task wants_background_task;
+} watch_face_t;
+
+void movement_request_tick_frequency(uint8_t freq);
+bool movement_default_loop_handler(movement_event_t event, movement_settings_t *settings);
+void movement_move_to_face(uint8_t watch_face_index);
+void movement_illuminate_led(void);
+// a backup register for the face, 0 when all are taken
+uint8_t movement_claim_backup_register(void);
+
+#endif // MOVEMENT_H_
@@ -0,0 +1,31 @@
+#ifndef WATCH_H_
+#define WATCH_H_
+
+// Host stand-in for the Sensor Watch watch library, only what the faces here use.
+// The LCD is an in-memory framebuffer of 3 COM x 24 SEG pixels, see host_watch.h.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void watch_set_pixel(uint8_t com, uint8_t seg);
+void watch_clear_pixel(uint8_t com, uint8_t seg);
+void watch_clear_display(void);
+void watch_display_character(uint8_t character, uint8_t position);
+void watch_display_character_lp_seconds(uint8_t character, uint8_t position);
+void watch_display_string(char *string, uint8_t position);
+void watch_set_colon(void);
+void watch_clear_colon(void);
+
+// the 8 backup registers of the RTC, they keep their value across a reset; the host keeps them in
+// host_watch_backup_file() when one is set
+void watch_store_backup_data(uint32_t data, uint8_t reg);
+uint32_t watch_get_backup_data(uint8_t reg);
+
+// the hardware build gets these from the TRNG, the host stand-ins are seeded with host_watch_seed()
+uint32_t arc4random(void);
+uint32_t arc4random_uniform(uint32_t upper_bound);
+
+#endif // WATCH_H_
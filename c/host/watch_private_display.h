@@ -0,0 +1,42 @@
+#ifndef WATCH_PRIVATE_DISPLAY_H_
+#define WATCH_PRIVATE_DISPLAY_H_
+
+#include "watch.h"
+
+// glyphs from 0x20 to 0x7f, bit 0..6 segments A..G, bit 7 the extra segment of position 0 (as Sensor Watch's Character_Set)
+static const uint8_t Character_Set[] = {
+    0b00000000, 0b01100000, 0b00100010, 0b01100011, 0b00101101, 0b00000000, 0b01000100, 0b00100000, //  !"#$%&'
+    0b00111001, 0b00001111, 0b11000000, 0b01110000, 0b00000100, 0b01000000, 0b01000000, 0b00010010, // ()*+,-./
+    0b00111111, 0b00000110, 0b01011011, 0b01001111, 0b01100110, 0b01101101, 0b01111101, 0b00000111, // 01234567
+    0b01111111, 0b01101111, 0b00000000, 0b00000000, 0b01011000, 0b01001000, 0b01001100, 0b01010011, // 89:;<=>?
+    0b11111111, 0b01110111, 0b01111111, 0b00111001, 0b00111111, 0b01111001, 0b01110001, 0b00111101, // @ABCDEFG
+    0b01110110, 0b10001001, 0b00001110, 0b01110101, 0b00111000, 0b10110111, 0b00110111, 0b00111111, // HIJKLMNO
+    0b01110011, 0b01100111, 0b11110111, 0b01101101, 0b10000001, 0b00111110, 0b00111110, 0b10111110, // PQRSTUVW
+    0b01111110, 0b01101110, 0b00011011, 0b00111001, 0b00100100, 0b00001111, 0b00100011, 0b00001000, // XYZ[\]^_
+    0b00000010, 0b01011111, 0b01111100, 0b01011000, 0b01011110, 0b01111011, 0b01110001, 0b01101111, // `abcdefg
+    0b01110100, 0b00010000, 0b01000010, 0b01110101, 0b00110000, 0b10110111, 0b01010100, 0b01011100, // hijklmno
+    0b01110011, 0b01100111, 0b01010000, 0b01101101, 0b01111000, 0b01100010, 0b01100010, 0b10111110, // pqrstuvw
+    0b01111110, 0b01101110, 0b00011011, 0b00010110, 0b00110110, 0b00110100, 0b01000001, 0b00000000, // xyz{|}~
+};
+
+// pixel of segments A..G and the extra segment per position, a byte (com << 6) | seg per segment from A in the
+// low byte, com 3 for none (as Sensor Watch's Segment_Map).
+// Positions 3 to 9 are the ones of picolisp/lcd.l and setChar in bird_poker_face.c, A and D are joined
+// on positions 4 and 6. Positions 0 to 2 are not mapped there, the stand-in puts them on the pixels left over
+// next to the colon at (1, 16).
+static const uint64_t Segment_Map[] = {
+    0x90108F4F0F8E4E0E, // Position 0
+    0xFF8D4D0D8C4C0C8B, // Position 1
+    0xFF4B0B4A0A894909, // Position 2
+    0xFF48088886874707, // Position 3
+    0xFF53921252139352, // Position 4
+    0xFF54511415559594, // Position 5
+    0xFF57965616179716, // Position 6
+    0xFF41804000018A81, // Position 7
+    0xFF43420203048382, // Position 8
+    0xFF45440506468584, // Position 9
+};
+
+#define Num_Chars 10
+
+#endif // WATCH_PRIVATE_DISPLAY_H_
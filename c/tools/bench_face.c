@@ -0,0 +1,591 @@
+// gcc -O2 -Wall -I.. -I../host bench_face.c ../host/host_watch.c -o bench_face
+//
+// ./bench_face [-r repeats] [-S seed] [-b baseline.jsonl] [-t percent] > results.jsonl
+// ./bench_face -c        check save_pack and save_unpack of bird_poker_save.h
+//
+// Benchmarks the hot paths of the face, built in (static functions included), on the host:
+// scoring over all 6188 hands, dealing, setChar/setNum (into the frame), the save to the backup registers
+// and handleEvent per screen (with the commit of the frame to the LCD), for one hand and for 3, 10 and 100 hands.
+// Writes one JSON object per benchmark line. With -b it compares ns_per_op to an earlier run
+// and exits 1 when any benchmark got more than -t percent (default 10) slower.
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "bird_poker_face.c"
+#include "host_watch.h"
+
+#define MAX_BENCHES 256
+#define BENCH_NAME 64
+
+typedef struct {
+    char name[BENCH_NAME];
+    uint64_t ops;
+    double ns_per_op;
+    double cycles_per_op;
+} bench_result_t;
+
+static bench_result_t results[MAX_BENCHES];
+static int results_length = 0;
+static uint64_t repeats = 200;
+static volatile uint32_t sink;
+
+static uint8_t corpus[HAND_COUNT][5]; // all hands, cards shuffled within each hand
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc(); // reference cycles
+#else
+    return 0;
+#endif
+}
+
+typedef struct {
+    double ns;
+    uint64_t cycles;
+} bench_clock_t;
+
+static bench_clock_t bench_start(void) {
+    bench_clock_t c = {now_ns(), cycles()};
+    return c;
+}
+
+static void bench_end(const char *name, bench_clock_t start, uint64_t ops) {
+    uint64_t c = cycles() - start.cycles;
+    double ns = now_ns() - start.ns;
+    bench_result_t *r = &results[results_length++];
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    r->ops = ops;
+    r->ns_per_op = ns / ops;
+    r->cycles_per_op = (double) c / ops;
+    printf("{\"name\": \"%s\", \"ops\": %llu, \"ns_per_op\": %.3f, \"cycles_per_op\": %.3f}\n", r->name, (unsigned long long) ops, r->ns_per_op, r->cycles_per_op);
+}
+
+static void bench_scoring(void) {
+    uint32_t acc = 0;
+    bench_clock_t t = bench_start();
+    for (uint64_t r = 0; r < repeats; r++) {
+        for (int i = 0; i < HAND_COUNT; i++) {
+            acc += score(corpus[i][0], corpus[i][1], corpus[i][2], corpus[i][3], corpus[i][4]);
+        }
+    }
+    bench_end("score", t, repeats * HAND_COUNT);
+
+    t = bench_start();
+    for (uint64_t r = 0; r < repeats; r++) {
+        for (int i = 0; i < HAND_COUNT; i++) {
+            int hnd[5] = {corpus[i][0], corpus[i][1], corpus[i][2], corpus[i][3], corpus[i][4]};
+            handsort(hnd);
+            acc += hnd[0];
+        }
+    }
+    bench_end("handsort", t, repeats * HAND_COUNT);
+
+    t = bench_start();
+    for (uint64_t r = 0; r < repeats; r++) {
+        for (int i = 0; i < HAND_COUNT; i++) {
+            acc += score_mask(hand_mask(corpus[i]));
+        }
+    }
+    bench_end("score_mask", t, repeats * HAND_COUNT);
+
+    t = bench_start();
+    for (uint64_t r = 0; r < repeats; r++) {
+        for (int i = 0; i < HAND_COUNT; i++) {
+            acc += score_lookup(hand_mask(corpus[i]));
+        }
+    }
+    bench_end("score_lookup", t, repeats * HAND_COUNT);
+    sink = acc;
+}
+
+static void bench_dealing(void) {
+    uint32_t acc = 0;
+    uint64_t ops = repeats * HAND_COUNT;
+    bird_poker_face_state_t state = {0};
+    bird_poker_rng_seed(&state.rng, arc4random(), 0);
+    bench_clock_t t = bench_start();
+    for (uint64_t i = 0; i < ops; i++) {
+        acc += bird_poker_rng_below(&state.rng, 17);
+    }
+    bench_end("bird_poker_rng_below", t, ops);
+
+    t = bench_start();
+    for (uint64_t i = 0; i < ops; i++) {
+        state.discards = 0xFF;
+        state.dealt = 0;
+        _deal(&state);
+        acc += state.dealt;
+    }
+    bench_end("_deal/deal", t, ops);
+
+    t = bench_start();
+    for (uint64_t i = 0; i < ops; i++) {
+        state.discards = 0x1F;
+        state.dealt = 0;
+        _deal(&state);
+        state.discards = i & 0x1F;
+        _deal(&state);
+        acc += state.dealt;
+    }
+    bench_end("_deal/deal_and_redraw", t, ops);
+
+    // one redraw tick of a multi hand deal, holding 2 cards
+    t = bench_start();
+    for (uint64_t i = 0; i < ops; i++) {
+        state.deal_hands = MAX_HANDS;
+        state.hands_played = 0;
+        uint32_t hand = hand_unrank(i % HAND_COUNT);
+        uint32_t rest = hand & (hand - 1);
+        state.hands_dealt = hand;
+        state.hands_held = (hand & -hand) | (rest & -rest);
+        _playHands(&state, HANDS_PER_TICK);
+        acc += state.settle_counts[HighC];
+    }
+    bench_end("_playHands/tick", t, ops);
+    sink = acc;
+}
+
+static void bench_display(void) {
+    uint64_t ops = 0;
+    bench_clock_t t = bench_start();
+    for (uint64_t r = 0; r < repeats * 10; r++) {
+        for (uint8_t c = 1; c < sizeof(CARD_CHARS); c++) {
+            for (uint8_t position = 5; position < 10; position++) {
+                setChar(position, CARD_CHARS[c]);
+                ops++;
+            }
+        }
+    }
+    bench_end("setChar/cards", t, ops);
+
+    static const char TITLE_CHARS[] = "bALW1nrFH1P 3KFLSt4KSF5K";
+    ops = 0;
+    t = bench_start();
+    for (uint64_t r = 0; r < repeats * 10; r++) {
+        for (uint8_t c = 0; c < sizeof(TITLE_CHARS) - 1; c++) {
+            setChar(c & 1, TITLE_CHARS[c]);
+            ops++;
+        }
+    }
+    bench_end("setChar/titles", t, ops);
+
+    static const uint64_t NUMS[] = {0, 7, 42, 250, 9999, 123456, 1234567, 987654321012ull};
+    for (uint8_t n = 0; n < sizeof(NUMS) / sizeof(NUMS[0]); n++) {
+        char name[BENCH_NAME];
+        snprintf(name, sizeof(name), "setNum/%llu", (unsigned long long) NUMS[n]);
+        ops = repeats * 1000;
+        t = bench_start();
+        for (uint64_t i = 0; i < ops; i++) {
+            setNum(NUMS[n]);
+        }
+        bench_end(name, t, ops);
+
+        // the marquee frames of a tick, formatted once as on EV_INIT
+        char num_chars[NUM_CHARS];
+        uint8_t length = formatNum(NUMS[n], num_chars);
+        uint8_t frames = length > 6 ? length - 4 : 1;
+        snprintf(name, sizeof(name), "setNumChars/%llu", (unsigned long long) NUMS[n]);
+        t = bench_start();
+        for (uint64_t i = 0; i < ops; i++) {
+            setNumChars(num_chars, length, i % frames);
+        }
+        bench_end(name, t, ops);
+    }
+}
+
+static void bench_save(void) {
+    bird_poker_face_state_t state = {0};
+    state.balance = 1234567;
+    state.jackpot = 250;
+    state.hands = 10;
+    state.deal_hands = 10;
+    state.discards = 0x1F;
+    bird_poker_rng_seed(&state.rng, arc4random(), 0);
+    _deal(&state);
+    uint64_t ops = repeats * 100;
+    bird_poker_save_t save = {0};
+    uint32_t acc = 0;
+    bench_clock_t t = bench_start();
+    for (uint64_t i = 0; i < ops; i++) {
+        state.select_i = i % 6;
+        save_pack(&state, SAVE_HOLD, i & 0x1F, state.select_i, &save);
+        acc += save.words[0];
+    }
+    bench_end("save_pack", t, ops);
+
+    uint8_t round;
+    uint8_t discards;
+    uint8_t select_i;
+    t = bench_start();
+    for (uint64_t i = 0; i < ops; i++) {
+        acc += save_unpack(&save, &state, &round, &discards, &select_i);
+    }
+    bench_end("save_unpack", t, ops);
+
+    // a tick on the hold, nothing changed and nothing written
+    save_regs[0] = 4;
+    save_regs[1] = 5;
+    save_regs[2] = 6;
+    save_regs[3] = 7;
+    state.screen = SCREEN_SELECT;
+    _save(&state);
+    t = bench_start();
+    for (uint64_t i = 0; i < ops; i++) {
+        _save(&state);
+    }
+    bench_end("_save/unchanged", t, ops);
+    sink = acc;
+}
+
+// 1 when save_unpack doesn't give back what save_pack packed of state
+static int save_fails(const bird_poker_face_state_t *state, uint8_t round, uint8_t discards, uint8_t select_i) {
+    bird_poker_save_t save;
+    bird_poker_face_state_t restored = {0};
+    uint8_t restored_round;
+    uint8_t restored_discards;
+    uint8_t restored_select_i;
+    if (!save_pack(state, round, discards, select_i, &save) ||
+        !save_unpack(&save, &restored, &restored_round, &restored_discards, &restored_select_i) ||
+        restored_round != round || restored_discards != discards || restored_select_i != select_i ||
+        restored.balance != state->balance || restored.jackpot != state->jackpot || restored.hands != state->hands) {
+        return 1;
+    }
+    if (round != SAVE_NONE && (memcmp(restored.hand, state->hand, 5) != 0 || restored.dealt != state->dealt ||
+                               restored.deal_hands != state->deal_hands)) {
+        return 1;
+    }
+    return round == SAVE_REDRAW && (restored.hands_dealt != state->hands_dealt || restored.hands_held != state->hands_held);
+}
+
+// the bytes of x as a varint
+static uint8_t varint_bytes(uint64_t x) {
+    uint8_t n = 1;
+    for (; x >= 0x80; x >>= 7) {
+        n++;
+    }
+    return n;
+}
+
+// round trips every dealt hand in every order, every hold with every redraw, discards, select_i, hands and the
+// balances and jackpots either side of the varint byte lengths; a flipped bit and erased registers don't restore
+static int check_save(void) {
+    uint8_t orders[120][5];
+    uint8_t order_count = 0;
+    for (uint8_t a = 0; a < 5; a++) {
+        for (uint8_t b = 0; b < 5; b++) {
+            for (uint8_t c = 0; c < 5; c++) {
+                for (uint8_t d = 0; d < 5; d++) {
+                    uint8_t e = 10 - a - b - c - d;
+                    if (a != b && a != c && a != d && b != c && b != d && c != d && e < 5 && e != a && e != b &&
+                        e != c && e != d) {
+                        uint8_t order[5] = {a, b, c, d, e};
+                        memcpy(orders[order_count++], order, 5);
+                    }
+                }
+            }
+        }
+    }
+    uint64_t saves = 0;
+    uint64_t fails = 0;
+    bird_poker_face_state_t state = {0};
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t dealt = hand_unrank(rank);
+        uint8_t cards[5];
+        for (uint8_t i = 0; i < 5; i++, dealt &= dealt - 1) {
+            cards[i] = __builtin_ctz(dealt);
+        }
+        dealt = hand_unrank(rank);
+        state.hands = SAVE_HANDS[rank % 4];
+        state.deal_hands = 1 + rank % state.hands;
+        for (uint8_t o = 0; o < 120; o++) {
+            for (uint8_t i = 0; i < 5; i++) {
+                state.hand[i] = cards[orders[o][i]];
+            }
+            state.dealt = dealt;
+            state.balance = rank * 120 + o;
+            state.jackpot = PAYOUTS_PRIZES[Royal] + o;
+            uint8_t discards = (rank + o) & 0x1F;
+            if (save_fails(&state, SAVE_HOLD, discards, o % 6)) {
+                fprintf(stderr, "SAVE MISMATCH hold mask %05x order %u discards %02x\n", dealt, o, discards);
+                fails++;
+            }
+            saves++;
+        }
+        // every hold with every redraw, the redrawn cards low to high in the discarded ones' places
+        for (uint8_t discards = 1; discards < 32; discards++) {
+            const uint8_t *order = orders[(rank + discards) % 120];
+            uint8_t redrawn = __builtin_popcount(discards);
+            state.hands_dealt = dealt;
+            state.hands_held = 0;
+            for (uint8_t i = 0; i < 5; i++) {
+                if (!(discards & (1 << i))) {
+                    state.hands_held |= 1 << cards[order[i]];
+                }
+            }
+            for (uint16_t redraw = 0; redraw < HAND_BINOM[12][redrawn]; redraw++) {
+                uint32_t drawn = log_redraw_unrank(dealt, redrawn, redraw);
+                for (uint8_t i = 0; i < 5; i++) {
+                    state.hand[i] = cards[order[i]];
+                }
+                save_place(state.hand, discards, drawn);
+                state.dealt = dealt | drawn;
+                if (save_fails(&state, SAVE_REDRAW, discards, 0)) {
+                    fprintf(stderr, "SAVE MISMATCH redraw mask %05x discards %02x redraw %u\n", dealt, discards, redraw);
+                    fails++;
+                }
+                saves++;
+            }
+        }
+    }
+
+    // the balance and jackpot fit when their varints take at most 8 bytes together, else the save doesn't restore
+    uint64_t values[2 + 2 * 9];
+    uint8_t value_count = 0;
+    values[value_count++] = 0;
+    values[value_count++] = UINT64_MAX;
+    for (uint8_t bits = 7; bits < 64; bits += 7) {
+        values[value_count++] = (1ull << bits) - 1;
+        values[value_count++] = 1ull << bits;
+    }
+    state.hands = 1;
+    for (uint8_t b = 0; b < value_count; b++) {
+        for (uint8_t j = 0; j < value_count; j++) {
+            state.balance = values[b];
+            state.jackpot = values[j];
+            bird_poker_save_t save;
+            bool fits = varint_bytes(values[b]) + varint_bytes(values[j]) <= SAVE_BYTES - 1 - SAVE_VARINTS;
+            bird_poker_face_state_t restored = {0};
+            uint8_t round;
+            uint8_t discards;
+            uint8_t select_i;
+            if (save_pack(&state, SAVE_NONE, 0, 0, &save) != fits || (fits && save_fails(&state, SAVE_NONE, 0, 0)) ||
+                (!fits && save_unpack(&save, &restored, &round, &discards, &select_i))) {
+                fprintf(stderr, "SAVE MISMATCH balance %llu jackpot %llu\n", (unsigned long long) values[b],
+                        (unsigned long long) values[j]);
+                fails++;
+            }
+            saves++;
+        }
+    }
+
+    // any one bit flipped of a save of every round, and registers all 0 or all 1
+    state.balance = 20;
+    state.jackpot = PAYOUTS_PRIZES[Royal];
+    for (uint8_t round = SAVE_NONE; round <= SAVE_REDRAW; round++) {
+        bird_poker_save_t save;
+        save_pack(&state, round, round == SAVE_REDRAW ? 0x03 : 0, 0, &save);
+        for (uint8_t bit = 0; bit < 32 * SAVE_WORDS; bit++) {
+            bird_poker_save_t flipped = save;
+            flipped.words[bit / 32] ^= 1u << (bit % 32);
+            bird_poker_face_state_t restored = {0};
+            uint8_t restored_round;
+            uint8_t discards;
+            uint8_t select_i;
+            if (save_unpack(&flipped, &restored, &restored_round, &discards, &select_i)) {
+                fprintf(stderr, "SAVE MISMATCH round %u bit %u flipped restores\n", round, bit);
+                fails++;
+            }
+            saves++;
+        }
+    }
+    for (uint8_t fill = 0; fill < 2; fill++) {
+        bird_poker_save_t erased;
+        memset(&erased, fill ? 0xFF : 0, sizeof(erased));
+        bird_poker_face_state_t restored = {0};
+        uint8_t round;
+        uint8_t discards;
+        uint8_t select_i;
+        if (save_unpack(&erased, &restored, &round, &discards, &select_i)) {
+            fprintf(stderr, "SAVE MISMATCH registers all %u restore\n", fill);
+            fails++;
+        }
+        saves++;
+    }
+    printf("%llu saves %llu fails\n", (unsigned long long) saves, (unsigned long long) fails);
+    return fails ? 1 : 0;
+}
+
+static const struct {
+    uint8_t screen;
+    const char *name;
+} SCREENS[] = {
+    {SCREEN_WELCOME, "WELCOME"},
+    {SCREEN_WELCOME_HANDS, "WELCOME_HANDS"},
+    {SCREEN_WELCOME_BALANCE, "WELCOME_BALANCE"},
+    {SCREEN_WELCOME_COMBO_ROYAL, "WELCOME_COMBO_ROYAL"},
+    {SCREEN_WELCOME_COMBOS, "WELCOME_COMBOS"},
+    {SCREEN_WELCOME_CARDS, "WELCOME_CARDS"},
+    {SCREEN_DEAL, "DEAL"},
+    {SCREEN_SELECT, "SELECT"},
+    {SCREEN_REDRAW, "REDRAW"},
+    {SCREEN_SETTLE, "SETTLE"},
+    {SCREEN_SETTLE_PRIZE, "SETTLE_PRIZE"},
+    {SCREEN_SETTLE_COMBOS, "SETTLE_COMBOS"},
+    {SCREEN_SETTLE_BALANCE, "SETTLE_BALANCE"},
+    {SCREEN_SETTLE_JACKPOT, "SETTLE_JACKPOT"},
+    {SCREEN_BUST, "BUST"},
+};
+
+// every screen and event from base, prefix goes before the screen in the names. init runs from the state the
+// screen is entered with, the other events from the one init left.
+static void bench_screens(const bird_poker_face_state_t *base, const char *prefix) {
+    static const uint8_t EVS[] = {EV_INIT, EV_TICK, EV_BOTTOM_RIGHT};
+    static const char *const EV_NAMES[] = {"init", "tick", "bottom_right"};
+    for (uint8_t s = 0; s < sizeof(SCREENS) / sizeof(SCREENS[0]); s++) {
+        for (uint8_t e = 0; e < sizeof(EVS); e++) {
+            bird_poker_face_state_t entered = *base;
+            entered.screen = SCREENS[s].screen;
+            bird_poker_face_state_t state = entered;
+            handleEvent(&state, EV_INIT); // tick_count and display_num_length as the screen sets them
+            state.screen = SCREENS[s].screen;
+            bird_poker_face_state_t snapshot = EVS[e] == EV_INIT ? entered : state;
+            char name[BENCH_NAME];
+            snprintf(name, sizeof(name), "handleEvent/%s%s/%s", prefix, SCREENS[s].name, EV_NAMES[e]);
+            uint64_t ops = repeats * 100;
+            bench_clock_t t = bench_start();
+            for (uint64_t i = 0; i < ops; i++) {
+                state = snapshot;
+                handleEvent(&state, EVS[e]);
+                commitFrame();
+            }
+            bench_end(name, t, ops);
+            sink = state.screen;
+        }
+    }
+}
+
+// one hand, then the multi hand deals of 3, 10 and MAX_HANDS hands, which play the extra hands on the redraw
+// ticks and at settle
+static void bench_handle_event(void) {
+    bird_poker_face_state_t base = {0};
+    base.balance = 1234567;
+    base.jackpot = 250;
+    base.hands = 1;
+    base.deal_hands = 1;
+    base.discards = 0x1F;
+    bird_poker_rng_seed(&base.rng, arc4random(), 0);
+    _deal(&base);
+    base.discards = 0x05;
+    base.settle_prize = 30;
+    base.hands_dealt = base.dealt;
+    for (uint8_t i = 0; i < 5; i++) {
+        if (!(base.discards & (1 << i))) {
+            base.hands_held |= 1 << base.hand[i];
+        }
+    }
+    base.settle_counts[score_lookup(hand_mask(base.hand)) >> 4] = 1;
+    bench_screens(&base, "");
+
+    for (uint8_t h = 1; h < 4; h++) {
+        base.hands = SAVE_HANDS[h];
+        base.deal_hands = SAVE_HANDS[h];
+        char prefix[16];
+        snprintf(prefix, sizeof(prefix), "h%u/", base.hands);
+        bench_screens(&base, prefix);
+    }
+}
+
+// compares to the results of an earlier run, returns the number of regressions
+static int compare_baseline(const char *path, double threshold) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    int regressions = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        char name[BENCH_NAME];
+        unsigned long long ops;
+        double ns_per_op;
+        double cycles_per_op;
+        if (sscanf(line, "{\"name\": \"%63[^\"]\", \"ops\": %llu, \"ns_per_op\": %lf, \"cycles_per_op\": %lf}", name, &ops, &ns_per_op, &cycles_per_op) != 4) {
+            continue;
+        }
+        for (int i = 0; i < results_length; i++) {
+            if (strcmp(results[i].name, name) == 0) {
+                double change = 100.0 * (results[i].ns_per_op - ns_per_op) / ns_per_op;
+                if (change > threshold) {
+                    fprintf(stderr, "REGRESSION %-52s %10.3f -> %10.3f ns/op %+7.1f%%\n", name, ns_per_op, results[i].ns_per_op, change);
+                    regressions++;
+                } else if (change < -threshold) {
+                    fprintf(stderr, "faster     %-52s %10.3f -> %10.3f ns/op %+7.1f%%\n", name, ns_per_op, results[i].ns_per_op, change);
+                }
+            }
+        }
+    }
+    fclose(f);
+    return regressions;
+}
+
+int main(int argc, char *argv[]) {
+    uint64_t seed = 1;
+    const char *baseline = NULL;
+    double threshold = 10;
+    int check = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "r:S:b:t:c")) != -1) {
+        switch (opt) {
+            case 'r':
+                repeats = strtoull(optarg, NULL, 10);
+                break;
+            case 'S':
+                seed = strtoull(optarg, NULL, 10);
+                break;
+            case 'b':
+                baseline = optarg;
+                break;
+            case 't':
+                threshold = atof(optarg);
+                break;
+            case 'c':
+                check = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: bench_face [-r repeats] [-S seed] [-b baseline.jsonl] [-t percent] | -c\n");
+                return 2;
+        }
+    }
+    if (check) {
+        return check_save();
+    }
+
+    host_watch_seed(seed);
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t mask = hand_unrank(rank);
+        for (int k = 0; k < 5; k++) {
+            corpus[rank][k] = __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+        for (int k = 4; k > 0; k--) {
+            int j = arc4random_uniform(k + 1);
+            uint8_t c = corpus[rank][k];
+            corpus[rank][k] = corpus[rank][j];
+            corpus[rank][j] = c;
+        }
+    }
+
+    bench_scoring();
+    host_watch_seed(seed);
+    bench_dealing();
+    bench_display();
+    bench_save();
+    host_watch_seed(seed);
+    bench_handle_event();
+
+    if (baseline) {
+        int regressions = compare_baseline(baseline, threshold);
+        if (regressions != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+// gcc -O2 -Wall -I.. bench_score_many.c score_many.c -o bench_score_many
+//
+// ./bench_score_many [hands]    score() in a loop against every score_many() path on the same random hands
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bird_poker_score.h"
+#include "score_many.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    uint8_t *hands = malloc(5 * n);
+    uint8_t *expect = malloc(n);
+    uint8_t *out = malloc(n);
+
+    uint32_t x = 2463534242u; // xorshift32, fixed seed
+    for (size_t i = 0; i < n; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        uint32_t mask = hand_unrank(x % HAND_COUNT);
+        for (int k = 0; k < 5; k++) {
+            hands[k * n + i] = __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    double t = now();
+    for (size_t i = 0; i < n; i++) {
+        expect[i] = score(hands[i], hands[n + i], hands[2 * n + i], hands[3 * n + i], hands[4 * n + i]);
+    }
+    double base = now() - t;
+    printf("%-8s %6.2f ns/hand %8.1f Mhands/s\n", "score()", 1e9 * base / n, n / base / 1e6);
+
+    int fails = 0;
+    for (int path = 0; path < SCORE_MANY_PATHS; path++) {
+        memset(out, 0, n);
+        t = now();
+        if (!score_many_with(path, hands, n, out)) {
+            printf("%-8s unsupported\n", score_many_path_name(path));
+            continue;
+        }
+        double dt = now() - t;
+        int ok = memcmp(out, expect, n) == 0;
+        fails += !ok;
+        printf("%-8s %6.2f ns/hand %8.1f Mhands/s %5.1fx %s\n", score_many_path_name(path), 1e9 * dt / n, n / dt / 1e6, base / dt, ok ? "ok" : "MISMATCH");
+    }
+    free(hands);
+    free(expect);
+    free(out);
+    return fails ? 1 : 0;
+}
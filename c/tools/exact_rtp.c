@@ -0,0 +1,234 @@
+// gcc -O2 -Wall -I.. exact_rtp.c subsets.c -o exact_rtp
+//
+// ./exact_rtp [-j royal] [paytable ...]                 paytables as PAYOUTS_PRIZES, 10 prizes 0,0,0,1,2,3,4,10,30,250
+// ./exact_rtp [-j royal] -                              one paytable per line from stdin
+// ./exact_rtp [-j royal] -o strategy.bin [paytable]    also write the solved strategy, see strategy_db.h
+// ./exact_rtp -r strategy.bin                          check a solved strategy against its paytable
+//
+// Exact return to player of one round under optimal play, the hold with the best expected prize for every
+// dealt hand (first best as hold_best), for each paytable (default PAYOUTS_PRIZES). The Royal entry is the
+// jackpot it pays, -j overrides it. Prints the return, the variance and the hit rate (the chance of a prize)
+// as fractions and doubles, and the chance of every combi of the final hand.
+//
+// All 6188 dealt hands are equally likely. The combi counts of every hold of every hand over all redraws,
+// 32 x 6188 x 10, are the same for every paytable and counted once at startup from the subset counts of
+// subsets.h. A paytable then only weighs those counts.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bird_poker_score.h"
+#include "subsets.h"
+#include "strategy_db.h"
+
+typedef unsigned __int128 u128;
+
+// the best hold by rank and the prizes of its redraws, of the last paytable evaluated
+static uint8_t BEST[HAND_COUNT];
+static uint64_t BEST_TOTALS[HAND_COUNT];
+
+static u128 gcd(u128 a, u128 b) {
+    while (b) {
+        u128 r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+static void print_u128(u128 x) {
+    char digits[40];
+    int n = 0;
+    do {
+        digits[n++] = '0' + (int) (x % 10);
+        x /= 10;
+    } while (x);
+    while (n) {
+        putchar(digits[--n]);
+    }
+}
+
+// num / den in lowest terms and as a double
+static void print_fraction(const char *name, u128 num, u128 den) {
+    u128 g = gcd(num, den);
+    printf("%-9s ", name);
+    print_u128(num / g);
+    printf("/");
+    print_u128(den / g);
+    printf(" = %.9f\n", (double) num / (double) den);
+}
+
+static void evaluate(const uint64_t prizes[10]) {
+    u128 returned = 0;
+    u128 squares = 0;
+    u128 combis[10] = {0};
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint8_t best = 31;
+        u128 best_total = 0;
+        for (int8_t hold = 31; hold >= 0; hold--) {
+            u128 total = 0;
+            for (uint8_t combi = HighC; combi <= Royal; combi++) {
+                total += (u128) HOLD_COUNTS[rank][hold][combi] * prizes[combi];
+            }
+            // total / draws of hold against the best so far, first best wins
+            uint8_t held = __builtin_popcount(hold);
+            if (hold == 31 || total * HOLD_DRAWS[__builtin_popcount(best)] > best_total * HOLD_DRAWS[held]) {
+                best = hold;
+                best_total = total;
+            }
+        }
+        BEST[rank] = best;
+        BEST_TOTALS[rank] = best_total;
+        uint16_t weight = HOLD_DRAWS_LCM / HOLD_DRAWS[__builtin_popcount(best)];
+        for (uint8_t combi = HighC; combi <= Royal; combi++) {
+            u128 count = (u128) HOLD_COUNTS[rank][best][combi] * weight;
+            combis[combi] += count;
+            returned += count * prizes[combi];
+            squares += count * prizes[combi] * prizes[combi];
+        }
+    }
+    u128 den = (u128) HAND_COUNT * HOLD_DRAWS_LCM;
+    u128 hits = 0;
+    printf("paytable");
+    for (uint8_t combi = 0; combi <= Royal; combi++) {
+        printf(" %llu", (unsigned long long) prizes[combi]);
+        if (prizes[combi]) {
+            hits += combis[combi];
+        }
+    }
+    printf("\n");
+    print_fraction("return", returned, den);
+    // squares / den - (returned / den)^2 over den^2
+    print_fraction("variance", squares * den - returned * returned, den * den);
+    print_fraction("hit rate", hits, den);
+    for (uint8_t combi = Royal; combi >= HighC; combi--) {
+        print_fraction(PAYOUTS_NAMES[combi], combis[combi], den);
+    }
+}
+
+static int write_db(const char *path, const uint64_t prizes[10]) {
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    strategy_db_header_t header = {.version = STRATEGY_DB_VERSION, .subset_count = SUBSET_COUNT, .hand_count = HAND_COUNT};
+    memcpy(header.magic, STRATEGY_DB_MAGIC, sizeof(header.magic));
+    memcpy(header.prizes, prizes, sizeof(header.prizes));
+    fwrite(&header, sizeof(header), 1, f);
+    fwrite(SUBSET_COMBIS, sizeof(SUBSET_COMBIS), 1, f);
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        strategy_db_hand_t hand = {.total = BEST_TOTALS[rank], .hold = BEST[rank]};
+        memcpy(hand.combis, HOLD_COUNTS[rank][BEST[rank]], sizeof(hand.combis));
+        fwrite(&hand, sizeof(hand), 1, f);
+    }
+    if (fclose(f) != 0) {
+        perror(path);
+        return 1;
+    }
+    return 0;
+}
+
+// reads a solved strategy, solves its paytable again and compares
+static int check_db(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    static uint16_t subset_combis[SUBSET_COUNT][10];
+    static strategy_db_hand_t hands[HAND_COUNT];
+    strategy_db_header_t header;
+    int read = fread(&header, sizeof(header), 1, f) == 1 && fread(subset_combis, sizeof(subset_combis), 1, f) == 1 &&
+               fread(hands, sizeof(hands), 1, f) == 1;
+    fclose(f);
+    if (!read || memcmp(header.magic, STRATEGY_DB_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != STRATEGY_DB_VERSION || header.subset_count != SUBSET_COUNT || header.hand_count != HAND_COUNT) {
+        fprintf(stderr, "%s: not a strategy of this version\n", path);
+        return 1;
+    }
+    evaluate(header.prizes);
+    int fails = 0;
+    if (memcmp(subset_combis, SUBSET_COMBIS, sizeof(subset_combis)) != 0) {
+        fprintf(stderr, "SUBSET MISMATCH\n");
+        fails++;
+    }
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        if (hands[rank].hold != BEST[rank] || hands[rank].total != BEST_TOTALS[rank] ||
+            memcmp(hands[rank].combis, HOLD_COUNTS[rank][BEST[rank]], sizeof(hands[rank].combis)) != 0) {
+            fprintf(stderr, "HOLD MISMATCH mask %05x file %02x solved %02x\n", hand_unrank(rank), hands[rank].hold, BEST[rank]);
+            fails++;
+        }
+    }
+    printf("%d hands %d fails\n", HAND_COUNT, fails);
+    return fails ? 1 : 0;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: exact_rtp [-j royal] [-o strategy.bin] [paytable ... | -]\n");
+    fprintf(stderr, "       exact_rtp -r strategy.bin\n");
+    exit(2);
+}
+
+int main(int argc, char *argv[]) {
+    uint64_t royal = 0;
+    const char *out = NULL;
+    const char *in = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "j:o:r:")) != -1) {
+        switch (opt) {
+            case 'j':
+                royal = strtoull(optarg, NULL, 10);
+                break;
+            case 'o':
+                out = optarg;
+                break;
+            case 'r':
+                in = optarg;
+                break;
+            default:
+                usage();
+        }
+    }
+    int arg = optind;
+    // one paytable to write
+    if (out && (argc - arg > 1 || (arg < argc && strcmp(argv[arg], "-") == 0))) {
+        usage();
+    }
+
+    clock_t t = clock();
+    subsets_init();
+    fprintf(stderr, "counted holds in %.2fs\n", (double) (clock() - t) / CLOCKS_PER_SEC);
+    t = clock();
+
+    uint64_t prizes[10];
+    if (in) {
+        return check_db(in);
+    } else if (arg == argc) {
+        for (uint8_t combi = 0; combi <= Royal; combi++) {
+            prizes[combi] = PAYOUTS_PRIZES[combi];
+        }
+        if (royal) {
+            prizes[Royal] = royal;
+        }
+        evaluate(prizes);
+    } else if (strcmp(argv[arg], "-") == 0) {
+        char line[512];
+        while (fgets(line, sizeof(line), stdin)) {
+            if (parse_paytable(line, royal, prizes)) {
+                evaluate(prizes);
+                fflush(stdout);
+            }
+        }
+    } else {
+        for (; arg < argc; arg++) {
+            if (!parse_paytable(argv[arg], royal, prizes)) {
+                usage();
+            }
+            evaluate(prizes);
+        }
+    }
+    fprintf(stderr, "evaluated in %.3fs\n", (double) (clock() - t) / CLOCKS_PER_SEC);
+    return out ? write_db(out, prizes) : 0;
+}
@@ -0,0 +1,201 @@
+// gcc -O2 -Wall -I.. -I../host gen_glyph_table.c -o gen_glyph_table
+//
+// ./gen_glyph_table ../../picolisp/lcd.l > ../bird_poker_glyph_table.h    regenerate the table
+// ./gen_glyph_table -c ../../picolisp/lcd.l                               check the compiled in table, and the
+//                                                                         host Segment_Map, against lcd.l
+//
+// Reads the segments of every character from setChar in lcd.l, characters lcd.l lacks keep their Character_Set
+// segments as watch_display_string draws them. The (com . seg) pixels of positions 4 to 9
+// in lcd.l are only checked: positions 0 to 3 are not mapped there, the face takes the pixels of all
+// positions from Segment_Map.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "watch_private_display.h"
+#include "bird_poker_glyph_table.h"
+
+#define MAX_NAMES 128
+
+// lcd.l names that are another character in the face
+static const struct {
+    const char *name;
+    char chr;
+} NAMES[] = {
+    {"W4", 'f'},
+    {"W7", 'r'},
+    {"WT", 't'},
+    {"WK", 'k'},
+    {"t", '^'}, // t of SUIt and BUSt, t is WT on the cards
+};
+
+static char names[MAX_NAMES][8];
+static uint8_t name_glyphs[MAX_NAMES];
+static int names_length = 0;
+static uint8_t glyphs[GLYPH_COUNT];
+static int16_t pixels[Num_Chars][9]; // (com << 6) | seg of segments A..I, -1 for none
+
+static int face_char(const char *name) {
+    for (size_t i = 0; i < sizeof(NAMES) / sizeof(NAMES[0]); i++) {
+        if (strcmp(name, NAMES[i].name) == 0) {
+            return NAMES[i].chr;
+        }
+    }
+    if (strlen(name) != 1 || (uint8_t) name[0] < 0x20 || (uint8_t) name[0] >= 0x20 + GLYPH_COUNT) {
+        return -1;
+    }
+    return name[0];
+}
+
+static uint8_t *name_glyph(const char *name) {
+    for (int i = 0; i < names_length; i++) {
+        if (strcmp(names[i], name) == 0) {
+            return &name_glyphs[i];
+        }
+    }
+    if (names_length == MAX_NAMES) {
+        fprintf(stderr, "too many characters\n");
+        exit(1);
+    }
+    snprintf(names[names_length], sizeof(names[0]), "%s", name);
+    return &name_glyphs[names_length++];
+}
+
+// segment letter A..I to the bit of Character_Set, H and I are the one extra segment of position 0
+static uint8_t segment_bit(char segment) {
+    return segment >= 'H' ? 0x80 : 1 << (segment - 'A');
+}
+
+static int parse(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    memset(pixels, 0xFF, sizeof(pixels));
+    static char text[1 << 16];
+    size_t length = 0;
+    char line[512];
+    int in_set_char = 0;
+    while (fgets(line, sizeof(line), f)) {
+        int position, com, seg;
+        char segment[2];
+        if (sscanf(line, " (de s%1d%1[A-I] (com%d . seg%d", &position, segment, &com, &seg) == 4) {
+            pixels[position][segment[0] - 'A'] = (com << 6) | seg;
+        }
+        in_set_char = in_set_char || strstr(line, "(de setChar");
+        if (in_set_char && length + strlen(line) < sizeof(text)) {
+            strcpy(text + length, line);
+            length += strlen(line);
+        }
+    }
+    fclose(f);
+    if (!in_set_char) {
+        fprintf(stderr, "%s: no setChar\n", path);
+        return 1;
+    }
+
+    // setChar is (case Chr (("A" "B" ...) (put LcdSym sX T))) per segment X
+    for (char *p = strstr(text, "(case Chr"); p; p = strstr(p, "(case Chr")) {
+        char *put = strstr(p, "(put LcdSym s");
+        if (!put) {
+            break;
+        }
+        uint8_t bit = segment_bit(put[13]);
+        for (char *q = strchr(p, '"'); q && q < put; q = strchr(q + 1, '"')) {
+            char *end = strchr(q + 1, '"');
+            char name[8];
+            snprintf(name, sizeof(name), "%.*s", (int) (end - q - 1), q + 1);
+            *name_glyph(name) |= bit;
+            q = end;
+        }
+        p = put;
+    }
+
+    int fails = 0;
+    uint8_t defined[GLYPH_COUNT] = {0};
+    for (int i = 0; i < names_length; i++) {
+        int c = face_char(names[i]);
+        if (c < 0) {
+            fprintf(stderr, "no character for %s\n", names[i]);
+            fails++;
+        } else if (defined[c - 0x20] && glyphs[c - 0x20] != name_glyphs[i]) {
+            fprintf(stderr, "%s is %c with other segments\n", names[i], c);
+            fails++;
+        } else {
+            glyphs[c - 0x20] = name_glyphs[i];
+            defined[c - 0x20] = 1;
+        }
+    }
+    for (int c = 0; c < GLYPH_COUNT; c++) {
+        if (!defined[c]) {
+            glyphs[c] = Character_Set[c];
+        }
+    }
+    return fails;
+}
+
+static int check(void) {
+    int fails = 0;
+    for (int c = 0; c < GLYPH_COUNT; c++) {
+        if (GLYPHS[c] != glyphs[c]) {
+            fprintf(stderr, "GLYPH MISMATCH '%c' table %02x lcd.l %02x\n", c + 0x20, GLYPHS[c], glyphs[c]);
+            fails++;
+        }
+    }
+    for (int position = 0; position < Num_Chars; position++) {
+        for (int segment = 0; segment < 7; segment++) {
+            if (pixels[position][segment] < 0) {
+                continue;
+            }
+            uint8_t px = Segment_Map[position] >> (8 * segment);
+            if (px != pixels[position][segment]) {
+                fprintf(stderr, "PIXEL MISMATCH s%d%c Segment_Map (%d . %d) lcd.l (%d . %d)\n", position, 'A' + segment,
+                        px >> 6, px & 0x3F, pixels[position][segment] >> 6, pixels[position][segment] & 0x3F);
+                fails++;
+            }
+        }
+    }
+    printf("%d characters %d fails\n", names_length, fails);
+    return fails;
+}
+
+static void generate(void) {
+    printf("#ifndef bird_poker_GLYPH_TABLE_H_\n");
+    printf("#define bird_poker_GLYPH_TABLE_H_\n\n");
+    printf("// Generated by tools/gen_glyph_table.c from picolisp/lcd.l, do not edit.\n");
+    printf("// GLYPHS[c - 0x20] are the segments of character c as in Character_Set: bit 0..6 segments A..G, bit 7 the\n");
+    printf("// inner bars of position 0. W4, W7, WT, WK of lcd.l are f, r, t, k (CARD_CHARS), the t of lcd.l is ^.\n");
+    printf("// Characters lcd.l lacks are the Character_Set ones.\n\n");
+    printf("#include <stdint.h>\n\n");
+    printf("#define GLYPH_COUNT %d\n\n", GLYPH_COUNT);
+    printf("static const uint8_t GLYPHS[GLYPH_COUNT] = {\n");
+    for (int row = 0; row < GLYPH_COUNT; row += 8) {
+        printf("   ");
+        for (int c = row; c < row + 8; c++) {
+            printf(" 0x%02x,", glyphs[c]);
+        }
+        printf(" // ");
+        for (int c = row; c < row + 8; c++) {
+            printf("%c", c + 0x20 == 0x7F ? ' ' : c + 0x20);
+        }
+        printf("\n");
+    }
+    printf("};\n\n");
+    printf("#endif // bird_poker_GLYPH_TABLE_H_\n");
+}
+
+int main(int argc, char *argv[]) {
+    int check_only = argc > 2 && strcmp(argv[1], "-c") == 0;
+    if (argc != 2 + check_only) {
+        fprintf(stderr, "usage: gen_glyph_table [-c] lcd.l\n");
+        return 2;
+    }
+    if (parse(argv[1 + check_only]) != 0) {
+        return 1;
+    }
+    if (check_only) {
+        return check() ? 1 : 0;
+    }
+    generate();
+    return 0;
+}
@@ -0,0 +1,199 @@
+// gcc -O2 -Wall -I.. gen_hold_table.c strategy.c jackpot.c subsets.c -o gen_hold_table
+//
+// ./gen_hold_table > ../bird_poker_hold_table.h    regenerate the tables, after PAYOUTS_PRIZES changed
+// ./gen_hold_table -c                              check the compiled in tables, hold_lookup() and
+//                                                  hold_lookup_jackpot() against hold_best()
+//
+// The holds are the ones of the optimal strategy of sim_rtp: the best expected prize with Royal paying the
+// starting jackpot PAYOUTS_PRIZES[Royal]. As the jackpot grows the best hold of a hand changes at the breaks
+// of jackpot.h, so HOLD_BREAKS lists the breaks above the starting jackpot of every hand that has any: the
+// jackpot of the break and the hold from then on, by rank and jackpot.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bird_poker_score.h"
+#include "bird_poker_hold_table.h"
+#include "jackpot.h"
+#include "strategy.h"
+
+// the breaks of 1 << BREAK_RANK_BITS ranks in a row make a bucket of HOLD_BREAKS
+#define BREAK_RANK_BITS 6
+
+// the first break of hand rank above the starting jackpot, the ones up to JACKPOT_BREAKS_FROM[rank + 1] follow
+static uint32_t hold_breaks_from(uint16_t rank) {
+    uint32_t i = JACKPOT_BREAKS_FROM[rank];
+    while (i < JACKPOT_BREAKS_FROM[rank + 1] && JACKPOT_BREAKS[i].from <= PAYOUTS_PRIZES[Royal]) {
+        i++;
+    }
+    return i;
+}
+
+static int check(void) {
+    int fails = 0;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t hand = hand_unrank(rank);
+        uint32_t held = hold_best(hand, PAYOUTS_PRIZES[Royal]);
+        if (hold_lookup(hand) != hold_bits(hand, held) || hold_lookup_cards(hand) != held) {
+            fprintf(stderr, "HOLD MISMATCH mask %05x table %02x cards %05x hold_best %05x\n", hand, hold_lookup(hand),
+                    hold_lookup_cards(hand), held);
+            fails++;
+        }
+        // either side of every break, far above and past 32 bits
+        uint64_t jackpots[2 * 32 + 3] = {PAYOUTS_PRIZES[Royal], 1000000, 1ull << 32};
+        uint8_t jackpot_count = 3;
+        for (uint32_t b = hold_breaks_from(rank); b < JACKPOT_BREAKS_FROM[rank + 1]; b++) {
+            jackpots[jackpot_count++] = JACKPOT_BREAKS[b].from - 1;
+            jackpots[jackpot_count++] = JACKPOT_BREAKS[b].from;
+        }
+        for (uint8_t i = 0; i < jackpot_count; i++) {
+            uint64_t jackpot = jackpots[i];
+            held = hold_best(hand, jackpot);
+            if (hold_lookup_jackpot(hand, jackpot) != hold_bits(hand, held) || hold_lookup_jackpot_cards(hand, jackpot) != held) {
+                fprintf(stderr, "HOLD MISMATCH mask %05x jackpot %llu table %02x hold_best %05x\n", hand,
+                        (unsigned long long) jackpot, hold_lookup_jackpot(hand, jackpot), held);
+                fails++;
+            }
+        }
+    }
+    printf("%d hands %d fails\n", HAND_COUNT, fails);
+    return fails ? 1 : 0;
+}
+
+static void generate(void) {
+    static uint8_t table[(HAND_COUNT * HOLD_BITS + 7) / 8];
+    uint32_t break_count = 0;
+    uint16_t break_hands = 0;
+    uint64_t break_max = 0;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t from = hold_breaks_from(rank);
+        for (uint32_t b = from; b < JACKPOT_BREAKS_FROM[rank + 1]; b++) {
+            break_max = JACKPOT_BREAKS[b].from > break_max ? JACKPOT_BREAKS[b].from : break_max;
+        }
+        break_count += JACKPOT_BREAKS_FROM[rank + 1] - from;
+        break_hands += JACKPOT_BREAKS_FROM[rank + 1] > from;
+
+        uint32_t hand = hand_unrank(rank);
+        uint16_t bits = hold_bits(hand, hold_best(hand, PAYOUTS_PRIZES[Royal])) << ((rank * HOLD_BITS) & 7);
+        table[rank * HOLD_BITS >> 3] |= bits;
+        if (bits >> 8) {
+            table[(rank * HOLD_BITS >> 3) + 1] |= bits >> 8;
+        }
+    }
+    // the jackpots of the breaks take the bits above the hold and the low rank bits, 32 bit entries when they fit
+    int wide = break_max >> (32 - HOLD_BITS - BREAK_RANK_BITS) != 0;
+
+    printf("#ifndef bird_poker_HOLD_TABLE_H_\n");
+    printf("#define bird_poker_HOLD_TABLE_H_\n\n");
+    printf("// Generated by tools/gen_hold_table.c, do not edit.\n");
+    printf("// The hold with the best expected prize of every 5 card hand, with Royal paying the starting jackpot\n");
+    printf("// PAYOUTS_PRIZES[Royal]. HOLD_BITS bits per hand_rank(mask), little endian, bit i holds the i-th lowest card\n");
+    printf("// of the hand. Check with tools/gen_hold_table -c\n\n");
+    printf("#include \"bird_poker_score.h\"\n\n");
+    printf("#define HOLD_BITS 5\n");
+    printf("#define HOLD_BREAK_COUNT %u\n", break_count);
+    printf("#define HOLD_BREAK_RANK_BITS %d\n\n", BREAK_RANK_BITS);
+    printf("static const uint8_t HOLD_TABLE[(HAND_COUNT * HOLD_BITS + 7) / 8] = {");
+    for (size_t i = 0; i < sizeof(table); i++) {
+        printf("%s0x%02x,", (i % 16) ? " " : "\n    ", table[i]);
+    }
+    printf("\n};\n\n");
+    printf("// The breaks above the starting jackpot, %u of %u hands have any, by hand_rank(mask) and jackpot: from the\n", break_hands, HAND_COUNT);
+    printf("// jackpot of HOLD_BREAKS >> (HOLD_BREAK_RANK_BITS + HOLD_BITS) on, up to the next break of the hand, the best\n");
+    printf("// hold is the low HOLD_BITS bits rather than the one of HOLD_TABLE. The HOLD_BREAK_RANK_BITS bits between are\n");
+    printf("// the low bits of the rank, HOLD_BREAK_BUCKETS[rank >> HOLD_BREAK_RANK_BITS] is the first break of the ranks\n");
+    printf("// with the high bits.\n");
+    printf("typedef %s hold_break_t;\n\n", wide ? "uint64_t" : "uint32_t");
+    printf("static const uint32_t HOLD_BREAK_BUCKETS[(HAND_COUNT >> HOLD_BREAK_RANK_BITS) + 2] = {");
+    uint32_t i = 0;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        if (rank % (1 << BREAK_RANK_BITS) == 0) {
+            printf("%s%u,", (rank >> BREAK_RANK_BITS) % 16 ? " " : "\n    ", i);
+        }
+        i += JACKPOT_BREAKS_FROM[rank + 1] - hold_breaks_from(rank);
+    }
+    printf("%s%u,\n};\n\n", ((HAND_COUNT >> BREAK_RANK_BITS) + 1) % 16 ? " " : "\n    ", i);
+    printf("static const hold_break_t HOLD_BREAKS[HOLD_BREAK_COUNT] = {");
+    i = 0;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        for (uint32_t b = hold_breaks_from(rank); b < JACKPOT_BREAKS_FROM[rank + 1]; b++, i++) {
+            uint64_t entry = (JACKPOT_BREAKS[b].from << BREAK_RANK_BITS | rank % (1 << BREAK_RANK_BITS)) << HOLD_BITS |
+                             JACKPOT_BREAKS[b].hold;
+            printf("%s0x%0*llx,", (i % 8) ? " " : "\n    ", wide ? 16 : 8, (unsigned long long) entry);
+        }
+    }
+    printf("\n};\n\n");
+    printf("static inline uint8_t hold_rank_lookup(uint16_t rank) {\n");
+    printf("    uint16_t bit = rank * HOLD_BITS;\n");
+    printf("    return ((HOLD_TABLE[bit >> 3] | (HOLD_TABLE[(bit >> 3) + 1] << 8)) >> (bit & 7)) & ((1 << HOLD_BITS) - 1);\n");
+    printf("}\n\n");
+    printf("// the HOLD_BITS bits of the best hold of the 5 card mask\n");
+    printf("static inline uint8_t hold_lookup(uint32_t mask) {\n");
+    printf("    return hold_rank_lookup(hand_rank(mask));\n");
+    printf("}\n\n");
+    printf("// the HOLD_BITS bits of the best hold of the 5 card mask with Royal paying jackpot\n");
+    printf("static inline uint8_t hold_lookup_jackpot(uint32_t mask, uint64_t jackpot) {\n");
+    printf("    uint16_t rank = hand_rank(mask);\n");
+    printf("    uint8_t low_rank = rank & ((1 << HOLD_BREAK_RANK_BITS) - 1);\n");
+    printf("    uint32_t end = HOLD_BREAK_BUCKETS[(rank >> HOLD_BREAK_RANK_BITS) + 1];\n");
+    printf("    // the first break of rank in its bucket, or of the next rank that has any\n");
+    printf("    uint32_t low = HOLD_BREAK_BUCKETS[rank >> HOLD_BREAK_RANK_BITS];\n");
+    printf("    uint32_t high = end;\n");
+    printf("    while (low < high) {\n");
+    printf("        uint32_t mid = (low + high) / 2;\n");
+    printf("        if (((HOLD_BREAKS[mid] >> HOLD_BITS) & ((1 << HOLD_BREAK_RANK_BITS) - 1)) < low_rank) {\n");
+    printf("            low = mid + 1;\n");
+    printf("        } else {\n");
+    printf("            high = mid;\n");
+    printf("        }\n");
+    printf("    }\n");
+    printf("    uint8_t hold = hold_rank_lookup(rank);\n");
+    printf("    for (; low < end && ((HOLD_BREAKS[low] >> HOLD_BITS) & ((1 << HOLD_BREAK_RANK_BITS) - 1)) == low_rank &&\n");
+    printf("           jackpot >= HOLD_BREAKS[low] >> (HOLD_BREAK_RANK_BITS + HOLD_BITS); low++) {\n");
+    printf("        hold = HOLD_BREAKS[low] & ((1 << HOLD_BITS) - 1);\n");
+    printf("    }\n");
+    printf("    return hold;\n");
+    printf("}\n\n");
+    printf("// the cards of the 5 card mask that the HOLD_BITS bits hold keep\n");
+    printf("static inline uint32_t hold_cards(uint32_t mask, uint8_t hold) {\n");
+    printf("    uint32_t held = 0;\n");
+    printf("    for (uint8_t i = 0; i < 5; i++, mask &= mask - 1) {\n");
+    printf("        if (hold & (1 << i)) {\n");
+    printf("            held |= mask & -mask;\n");
+    printf("        }\n");
+    printf("    }\n");
+    printf("    return held;\n");
+    printf("}\n\n");
+    printf("// the HOLD_BITS bits that keep the held cards of the 5 card mask, hold_cards the other way\n");
+    printf("static inline uint8_t hold_bits(uint32_t mask, uint32_t held) {\n");
+    printf("    uint8_t hold = 0;\n");
+    printf("    for (uint8_t i = 0; i < 5; i++, mask &= mask - 1) {\n");
+    printf("        if (held & mask & -mask) {\n");
+    printf("            hold |= 1 << i;\n");
+    printf("        }\n");
+    printf("    }\n");
+    printf("    return hold;\n");
+    printf("}\n\n");
+    printf("// the cards of the 5 card mask to hold\n");
+    printf("static inline uint32_t hold_lookup_cards(uint32_t mask) {\n");
+    printf("    return hold_cards(mask, hold_lookup(mask));\n");
+    printf("}\n\n");
+    printf("// the cards of the 5 card mask to hold with Royal paying jackpot\n");
+    printf("static inline uint32_t hold_lookup_jackpot_cards(uint32_t mask, uint64_t jackpot) {\n");
+    printf("    return hold_cards(mask, hold_lookup_jackpot(mask, jackpot));\n");
+    printf("}\n\n");
+    printf("#endif // bird_poker_HOLD_TABLE_H_\n");
+}
+
+int main(int argc, char *argv[]) {
+    uint64_t prizes[10];
+    for (uint8_t combi = 0; combi <= Royal; combi++) {
+        prizes[combi] = PAYOUTS_PRIZES[combi];
+    }
+    subsets_init();
+    jackpot_init(prizes);
+    if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+        return check();
+    }
+    generate();
+    return 0;
+}
@@ -0,0 +1,75 @@
+// gcc -O2 -Wall -I.. gen_score_table.c -o gen_score_table
+//
+// ./gen_score_table > ../bird_poker_score_table.h    regenerate the table
+// ./gen_score_table -c                               check the compiled in table and score_mask() against score()
+#include <stdio.h>
+#include <string.h>
+#include "bird_poker_score.h"
+#include "bird_poker_score_table.h"
+
+static int hand_cards(uint32_t mask, int hnd[5]) {
+    int n = 0;
+    for (int c = CA; c <= WK; c++) {
+        if (mask & (1 << c)) {
+            hnd[n++] = c;
+        }
+    }
+    return n;
+}
+
+static int check(void) {
+    int fails = 0;
+    uint16_t rank = 0;
+    for (uint32_t mask = 0; mask < (1 << 18); mask += 2) {
+        if (__builtin_popcount(mask) != 5) {
+            continue;
+        }
+        int hnd[5];
+        hand_cards(mask, hnd);
+        int s = score(hnd[0], hnd[1], hnd[2], hnd[3], hnd[4]);
+        if (hand_rank(mask) != rank || hand_unrank(rank) != mask) {
+            fprintf(stderr, "RANK MISMATCH mask %05x rank %d hand_rank %d hand_unrank %05x\n", mask, rank, hand_rank(mask), hand_unrank(rank));
+            fails++;
+        } else if (score_mask(mask) != s) {
+            fprintf(stderr, "SCORE_MASK MISMATCH %d %d %d %d %d score_mask %02x score %02x\n", hnd[0], hnd[1], hnd[2], hnd[3], hnd[4], score_mask(mask), s);
+            fails++;
+        } else if (SCORE_TABLE[rank] != s) {
+            fprintf(stderr, "SCORE MISMATCH %d %d %d %d %d table %02x score %02x\n", hnd[0], hnd[1], hnd[2], hnd[3], hnd[4], SCORE_TABLE[rank], s);
+            fails++;
+        }
+        rank++;
+    }
+    if (rank != HAND_COUNT) {
+        fprintf(stderr, "HAND COUNT %d\n", rank);
+        fails++;
+    }
+    printf("%d hands %d fails\n", rank, fails);
+    return fails ? 1 : 0;
+}
+
+static void generate(void) {
+    printf("#ifndef bird_poker_SCORE_TABLE_H_\n");
+    printf("#define bird_poker_SCORE_TABLE_H_\n\n");
+    printf("// Generated by tools/gen_score_table.c, do not edit.\n");
+    printf("// SCORE_TABLE[hand_rank(mask)] is score() of the 5 card hand mask, check with tools/gen_score_table -c\n\n");
+    printf("#include \"bird_poker_score.h\"\n\n");
+    printf("static const uint8_t SCORE_TABLE[HAND_COUNT] = {");
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        int hnd[5];
+        hand_cards(hand_unrank(rank), hnd);
+        printf("%s0x%02x,", (rank % 16) ? " " : "\n    ", score(hnd[0], hnd[1], hnd[2], hnd[3], hnd[4]));
+    }
+    printf("\n};\n\n");
+    printf("static inline uint8_t score_lookup(uint32_t mask) {\n");
+    printf("    return SCORE_TABLE[hand_rank(mask)];\n");
+    printf("}\n\n");
+    printf("#endif // bird_poker_SCORE_TABLE_H_\n");
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+        return check();
+    }
+    generate();
+    return 0;
+}
@@ -0,0 +1,245 @@
+// Binary hand history, see hand_log.h
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "hand_log.h"
+
+static const uint8_t MAGIC[6] = {'B', 'P', 'H', 'L', 'O', 'G'};
+
+hand_log_t *hand_log_face;
+
+// CRC-32C (Castagnoli), with the SSE4.2 crc32 instruction when the cpu has it, else 8 bytes a step on tables
+static uint32_t CRC_TABLES[8][256];
+static int crc_hardware;
+
+__attribute__((constructor))
+static void crc_init(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (uint8_t j = 0; j < 8; j++) {
+            crc = (crc >> 1) ^ (crc & 1 ? 0x82F63B78u : 0);
+        }
+        CRC_TABLES[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (uint8_t t = 1; t < 8; t++) {
+            CRC_TABLES[t][i] = (CRC_TABLES[t - 1][i] >> 8) ^ CRC_TABLES[0][CRC_TABLES[t - 1][i] & 0xFF];
+        }
+    }
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    crc_hardware = __builtin_cpu_supports("sse4.2");
+#endif
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_sse42(const uint8_t *p, size_t n) {
+    uint64_t crc = 0xFFFFFFFFu;
+    for (; n >= 8; p += 8, n -= 8) {
+        uint64_t word;
+        memcpy(&word, p, 8);
+        crc = __builtin_ia32_crc32di(crc, word);
+    }
+    for (; n; p++, n--) {
+        crc = __builtin_ia32_crc32qi(crc, *p);
+    }
+    return ~crc;
+}
+#endif
+
+static uint32_t crc32c(const uint8_t *p, size_t n) {
+#if defined(__x86_64__)
+    if (crc_hardware) {
+        return crc32c_sse42(p, n);
+    }
+#endif
+    uint32_t crc = 0xFFFFFFFFu;
+    for (; n >= 8; p += 8, n -= 8) {
+        uint32_t lo = crc ^ (p[0] | p[1] << 8 | p[2] << 16 | (uint32_t) p[3] << 24);
+        crc = CRC_TABLES[7][lo & 0xFF] ^ CRC_TABLES[6][(lo >> 8) & 0xFF] ^ CRC_TABLES[5][(lo >> 16) & 0xFF] ^
+              CRC_TABLES[4][lo >> 24] ^ CRC_TABLES[3][p[4]] ^ CRC_TABLES[2][p[5]] ^ CRC_TABLES[1][p[6]] ^
+              CRC_TABLES[0][p[7]];
+    }
+    for (; n; p++, n--) {
+        crc = (crc >> 8) ^ CRC_TABLES[0][(crc ^ *p) & 0xFF];
+    }
+    return ~crc;
+}
+
+static uint64_t get(const uint8_t *p, uint8_t n) {
+    uint64_t x = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        x |= (uint64_t) p[i] << (8 * i);
+    }
+    return x;
+}
+
+static uint8_t *put(uint8_t *p, uint64_t x, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++) {
+        *p++ = x >> (8 * i);
+    }
+    return p;
+}
+
+static uint8_t *put_varint(uint8_t *p, uint64_t x) {
+    while (x >= 0x80) {
+        *p++ = (x & 0x7F) | 0x80;
+        x >>= 7;
+    }
+    *p++ = x;
+    return p;
+}
+
+hand_log_t *hand_log_create(const char *path) {
+    hand_log_t *log = calloc(1, sizeof(hand_log_t));
+    log->file = fopen(path, "wb");
+    uint8_t header[HAND_LOG_HEADER_BYTES];
+    memcpy(header, MAGIC, 6);
+    put(header + 6, HAND_LOG_VERSION, 2);
+    if (!log->file || fwrite(header, sizeof(header), 1, log->file) != 1) {
+        int error = errno;
+        if (log->file) {
+            fclose(log->file);
+        }
+        free(log);
+        errno = error;
+        return NULL;
+    }
+    return log;
+}
+
+static int write_block(hand_log_t *log) {
+    if (!log->rounds) {
+        return 1;
+    }
+    uint8_t header[HAND_LOG_BLOCK_HEADER_BYTES];
+    uint8_t *p = put(header, log->length, 4);
+    p = put(p, log->rounds, 4);
+    p = put(p, log->block_balance, 8);
+    p = put(p, log->block_jackpot, 8);
+    put(p, crc32c(log->payload, log->length), 4);
+    int ok = fwrite(header, sizeof(header), 1, log->file) == 1 && fwrite(log->payload, log->length, 1, log->file) == 1 &&
+             fflush(log->file) == 0;
+    log->length = 0;
+    log->rounds = 0;
+    log->block_balance = log->balance;
+    log->block_jackpot = log->jackpot;
+    return ok;
+}
+
+void hand_log_write(hand_log_t *log, const bird_poker_round_t *round) {
+    uint8_t *p = log->payload + log->length;
+    p = put(p, round->deal | (uint32_t) round->hold << 13 | (uint32_t) round->redraw << 18 | (uint32_t) (round->hands != 1) << 28, 4);
+    *p++ = round->score;
+    p = put_varint(p, round->prize);
+    int64_t balance = round->balance - log->balance;
+    int64_t jackpot = round->jackpot - log->jackpot;
+    p = put_varint(p, ((uint64_t) balance << 1) ^ (uint64_t) (balance >> 63));
+    p = put_varint(p, ((uint64_t) jackpot << 1) ^ (uint64_t) (jackpot >> 63));
+    if (round->hands != 1) {
+        *p++ = round->hands;
+    }
+    log->length = p - log->payload;
+    log->rounds++;
+    log->balance = round->balance;
+    log->jackpot = round->jackpot;
+    if (log->length >= HAND_LOG_BLOCK_BYTES) {
+        write_block(log);
+    }
+}
+
+int hand_log_close(hand_log_t *log) {
+    int ok = write_block(log);
+    ok = fclose(log->file) == 0 && ok;
+    free(log);
+    return ok;
+}
+
+void bird_poker_log_round(const bird_poker_round_t *round) {
+    if (hand_log_face) {
+        hand_log_write(hand_log_face, round);
+    }
+}
+
+int hand_log_open(const char *path, hand_log_reader_t *r) {
+    memset(r, 0, sizeof(*r));
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return 0;
+    }
+    r->size = st.st_size;
+    if (r->size < HAND_LOG_HEADER_BYTES) {
+        fprintf(stderr, "%s: not a hand log\n", path);
+        close(fd);
+        return 0;
+    }
+    void *map = mmap(NULL, r->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror(path);
+        return 0;
+    }
+    r->map = map;
+    madvise(map, r->size, MADV_SEQUENTIAL);
+    if (memcmp(r->map, MAGIC, 6) != 0 || get(r->map + 6, 2) != HAND_LOG_VERSION) {
+        fprintf(stderr, "%s: not a hand log of version %d\n", path, HAND_LOG_VERSION);
+        hand_log_unmap(r);
+        return 0;
+    }
+    r->next_block = HAND_LOG_HEADER_BYTES;
+    return 1;
+}
+
+void hand_log_unmap(hand_log_reader_t *r) {
+    if (r->map) {
+        munmap((void *) r->map, r->size);
+        r->map = NULL;
+    }
+}
+
+int hand_log_next_block(hand_log_reader_t *r) {
+    while (r->next_block < r->size) {
+        if (r->size - r->next_block < HAND_LOG_BLOCK_HEADER_BYTES) {
+            r->torn = 1;
+            return 0;
+        }
+        const uint8_t *header = r->map + r->next_block;
+        uint32_t length = get(header, 4);
+        uint32_t rounds = get(header + 4, 4);
+        if (length > HAND_LOG_BLOCK_BYTES + HAND_LOG_ROUND_MAX_BYTES || (uint64_t) rounds * 8 > length) {
+            // the header itself is bad, nothing after it can be found
+            r->damaged++;
+            return 0;
+        }
+        if (r->size - r->next_block - HAND_LOG_BLOCK_HEADER_BYTES < length) {
+            r->torn = 1;
+            return 0;
+        }
+        r->next_block += HAND_LOG_BLOCK_HEADER_BYTES + length;
+        const uint8_t *payload = header + HAND_LOG_BLOCK_HEADER_BYTES;
+        if (crc32c(payload, length) != get(header + 24, 4)) {
+            r->damaged++;
+            continue;
+        }
+        r->blocks++;
+        if (!rounds) {
+            continue;
+        }
+        r->at = payload;
+        r->left = rounds;
+        r->balance = get(header + 8, 8);
+        r->jackpot = get(header + 16, 8);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+#ifndef bird_poker_HAND_LOG_H_
+#define bird_poker_HAND_LOG_H_
+
+// Binary hand history of bird_poker_log.h, append only, integers little endian:
+// "BPHLOG" and version u16 (1), then blocks of rounds:
+//   header   payload bytes u32, rounds u32, balance u64 and jackpot u64 after the round before the block
+//            (0 before the first round of the file), CRC-32C of the payload u32
+//   payload  per round:
+//            u32      deal (13 bits) | hold (5) << 13 | redraw (10) << 18 | 1 << 28 when hands isn't 1
+//            u8       score
+//            varints  prize, and the changes of balance and jackpot zigzag encoded (7 bits a byte low first)
+//            u8       hands, when not 1
+// A one hand round is 8 bytes for the most part. Blocks are written whole, a kill leaves at most a short last
+// block that the reader stops at; a block with a bad CRC is skipped, the next one starts from its own header.
+
+#include <stdio.h>
+#include <stddef.h>
+#include "bird_poker_log.h"
+
+#define HAND_LOG_VERSION 1
+#define HAND_LOG_HEADER_BYTES 8
+#define HAND_LOG_BLOCK_HEADER_BYTES 28
+#define HAND_LOG_BLOCK_BYTES 4096 // payload bytes a block is flushed at
+#define HAND_LOG_ROUND_MAX_BYTES (4 + 1 + 3 * 10 + 1)
+
+typedef struct {
+    FILE *file;
+    uint8_t payload[HAND_LOG_BLOCK_BYTES + HAND_LOG_ROUND_MAX_BYTES];
+    uint32_t length;
+    uint32_t rounds;
+    uint64_t block_balance; // before the block
+    uint64_t block_jackpot;
+    uint64_t balance; // after the last round
+    uint64_t jackpot;
+} hand_log_t;
+
+// a new log at path, NULL with errno on failure
+hand_log_t *hand_log_create(const char *path);
+void hand_log_write(hand_log_t *log, const bird_poker_round_t *round);
+// writes the last block and closes, 0 with errno on failure
+int hand_log_close(hand_log_t *log);
+
+// the log bird_poker_log_round writes the rounds of the face to, NULL for none
+extern hand_log_t *hand_log_face;
+
+typedef struct {
+    const uint8_t *map;
+    size_t size;
+    size_t next_block; // offset of the next block header
+    const uint8_t *at; // the next round of the current block
+    uint32_t left;     // rounds left of the current block
+    uint64_t balance;  // after the last round read
+    uint64_t jackpot;
+    uint64_t blocks;   // blocks read
+    uint64_t damaged;  // blocks skipped for a bad CRC or a bad length
+    int torn;          // the file ends in a short block
+} hand_log_reader_t;
+
+// maps the log at path, 0 with a message on stderr when it can't or it isn't a hand log
+int hand_log_open(const char *path, hand_log_reader_t *r);
+void hand_log_unmap(hand_log_reader_t *r);
+
+// moves to the next whole block with a good CRC, 0 at the end
+int hand_log_next_block(hand_log_reader_t *r);
+
+static inline uint64_t hand_log_varint(const uint8_t **p) {
+    uint64_t x = 0;
+    for (uint8_t shift = 0;; shift += 7) {
+        uint8_t b = *(*p)++;
+        x |= (uint64_t) (b & 0x7F) << shift;
+        if (!(b & 0x80) || shift == 63) {
+            return x;
+        }
+    }
+}
+
+// the next round into *round, decoded in place from the map; 0 at the end
+static inline int hand_log_next(hand_log_reader_t *r, bird_poker_round_t *round) {
+    if (!r->left && !hand_log_next_block(r)) {
+        return 0;
+    }
+    const uint8_t *p = r->at;
+    // a round is 8 bytes or more, the three varints take a byte each for the most part
+    uint64_t word = (uint64_t) p[0] | (uint64_t) p[1] << 8 | (uint64_t) p[2] << 16 | (uint64_t) p[3] << 24 |
+                    (uint64_t) p[4] << 32 | (uint64_t) p[5] << 40 | (uint64_t) p[6] << 48 | (uint64_t) p[7] << 56;
+    uint32_t head = word;
+    round->deal = head & 0x1FFF;
+    round->hold = (head >> 13) & 0x1F;
+    round->redraw = (head >> 18) & 0x3FF;
+    round->score = word >> 32;
+    uint64_t balance;
+    uint64_t jackpot;
+    if (!(word & 0x8080800000000000ull)) {
+        round->prize = (word >> 40) & 0x7F;
+        balance = (word >> 48) & 0x7F;
+        jackpot = word >> 56;
+        p += 8;
+    } else {
+        p += 5;
+        round->prize = hand_log_varint(&p);
+        balance = hand_log_varint(&p);
+        jackpot = hand_log_varint(&p);
+    }
+    r->balance += (balance >> 1) ^ -(balance & 1);
+    r->jackpot += (jackpot >> 1) ^ -(jackpot & 1);
+    round->balance = r->balance;
+    round->jackpot = r->jackpot;
+    round->hands = head >> 28 & 1 ? *p++ : 1;
+    r->at = p;
+    r->left--;
+    return 1;
+}
+
+#endif // bird_poker_HAND_LOG_H_
@@ -0,0 +1,72 @@
+// Optimal holds as the jackpot grows, see jackpot.h
+#include "jackpot.h"
+
+uint32_t JACKPOT_BREAKS_FROM[HAND_COUNT + 1];
+jackpot_break_t JACKPOT_BREAKS[HAND_COUNT * 32];
+
+jackpot_line_t jackpot_line(uint16_t rank, uint8_t hold, const uint64_t prizes[10]) {
+    const uint16_t *counts = HOLD_COUNTS[rank][hold];
+    int64_t weight = HOLD_DRAWS_LCM / HOLD_DRAWS[__builtin_popcount(hold)];
+    jackpot_line_t line = {0, counts[Royal] * weight};
+    for (uint8_t combi = HighC; combi < Royal; combi++) {
+        line.rest += counts[combi] * prizes[combi] * weight;
+    }
+    return line;
+}
+
+// the first best hold at jackpot, holds scanned from 31 down
+static uint8_t best_at(const jackpot_line_t lines[32], uint64_t jackpot) {
+    uint8_t best = 31;
+    for (int8_t hold = 30; hold >= 0; hold--) {
+        if (lines[hold].rest + lines[hold].royals * (int64_t) jackpot >
+            lines[best].rest + lines[best].royals * (int64_t) jackpot) {
+            best = hold;
+        }
+    }
+    return best;
+}
+
+void jackpot_init(const uint64_t prizes[10]) {
+    uint32_t n = 0;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        JACKPOT_BREAKS_FROM[rank] = n;
+        jackpot_line_t lines[32];
+        for (uint8_t hold = 0; hold < 32; hold++) {
+            lines[hold] = jackpot_line(rank, hold, prizes);
+        }
+        uint64_t from = 0;
+        uint8_t best = best_at(lines, from);
+        for (;;) {
+            JACKPOT_BREAKS[n++] = (jackpot_break_t) {from, best};
+            // a flatter or as steep line never overtakes the best, the first jackpot a steeper one does:
+            // scanned before best it wins a tie, after it only a strict lead
+            uint64_t next = UINT64_MAX;
+            for (uint8_t hold = 0; hold < 32; hold++) {
+                int64_t rise = lines[hold].royals - lines[best].royals;
+                if (rise <= 0) {
+                    continue;
+                }
+                int64_t gap = lines[best].rest - lines[hold].rest;
+                uint64_t at = gap < 0 ? 0 : hold > best ? (gap + rise - 1) / rise : gap / rise + 1;
+                if (at < next) {
+                    next = at;
+                }
+            }
+            if (next == UINT64_MAX) {
+                break;
+            }
+            // past from, as best leads there
+            from = next;
+            best = best_at(lines, from);
+        }
+    }
+    JACKPOT_BREAKS_FROM[HAND_COUNT] = n;
+}
+
+uint8_t jackpot_hold(uint16_t rank, uint64_t jackpot) {
+    uint32_t i = JACKPOT_BREAKS_FROM[rank];
+    while (i + 1 < JACKPOT_BREAKS_FROM[rank + 1] && JACKPOT_BREAKS[i + 1].from <= jackpot) {
+        i++;
+    }
+    return JACKPOT_BREAKS[i].hold;
+}
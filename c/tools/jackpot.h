@@ -0,0 +1,36 @@
+#ifndef bird_poker_JACKPOT_H_
+#define bird_poker_JACKPOT_H_
+
+// Optimal holds as the jackpot grows, for the jackpot tools.
+// With the Royal paying the jackpot J, the redraws of a hold of a dealt hand pay (rest + royals * J) / draws,
+// a line in J. Of the 32 lines the best (first best as hold_best at equal ones) only changes where a steeper
+// one overtakes it, so every hand has a few breaks: from jackpot J on, up to the next break, hold h is best.
+
+#include <stdint.h>
+#include "subsets.h"
+
+typedef struct {
+    uint64_t from; // the smallest jackpot with this hold best, the first break of a hand is from 0
+    uint8_t hold; // bit i holds the i-th lowest card of the hand as HOLD_TABLE
+} jackpot_break_t;
+
+// the breaks of hand rank are JACKPOT_BREAKS[JACKPOT_BREAKS_FROM[rank]] to [JACKPOT_BREAKS_FROM[rank + 1] - 1]
+extern uint32_t JACKPOT_BREAKS_FROM[HAND_COUNT + 1];
+extern jackpot_break_t JACKPOT_BREAKS[HAND_COUNT * 32];
+
+// the redraws of a hold times HOLD_DRAWS_LCM / draws: the other prizes of prizes (the Royal entry is not
+// used) and the Royals, comparable across holds
+typedef struct {
+    int64_t rest;
+    int64_t royals;
+} jackpot_line_t;
+
+jackpot_line_t jackpot_line(uint16_t rank, uint8_t hold, const uint64_t prizes[10]);
+
+// fills JACKPOT_BREAKS for prizes, call subsets_init first
+void jackpot_init(const uint64_t prizes[10]);
+
+// the best hold of hand rank with the Royal paying jackpot
+uint8_t jackpot_hold(uint16_t rank, uint64_t jackpot);
+
+#endif // bird_poker_JACKPOT_H_
@@ -0,0 +1,315 @@
+// gcc -O2 -Wall -I.. jackpot_model.c jackpot.c subsets.c strategy.c -o jackpot_model -lm
+//
+// ./jackpot_model [-s strategy] [-j seed | -j lo:hi] [-i increment | -i lo:hi]
+//
+// Long-run return of the progressive jackpot: the jackpot starts at the seed (default PAYOUTS_PRIZES[Royal]),
+// grows by the increment (default 1) on every deal before the hold, and a Royal pays it and resets it to the
+// seed. The rounds from one reset to the next are a renewal cycle, so the long-run return per round is
+// E[prizes of a cycle] / E[rounds of a cycle]. Prints it, the expected cycle length and the distribution of
+// the jackpot at a hit. With a range of seeds or increments, one line per pair.
+//
+// -s aware (the default) holds the best for the jackpot of the round from the breaks of jackpot.h at any
+// seed, the other strategies of strategy.h hold what they do at the seed. Round k of a cycle deals at jackpot
+// seed + increment k and has a Royal with a chance q(jackpot) and other prizes r(jackpot), both exact from
+// the hold counts of subsets.h and constant between the breaks of jackpot.h. Over a run of rounds with the
+// same q the cycle survives geometrically, so a seed and increment take closed-form sums over those runs
+// rather than a walk over the rounds.
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bird_poker_hold_table.h"
+#include "jackpot.h"
+#include "strategy.h"
+
+// jackpots from on, up to the next segment, have a Royal with chance royal and other prizes rest per round
+typedef struct {
+    uint64_t from;
+    double royal;
+    double rest;
+} segment_t;
+
+static segment_t SEGMENTS[HAND_COUNT * 32];
+static uint32_t segment_count;
+
+typedef struct {
+    double rounds; // expected rounds of a cycle
+    double returned; // long-run return per round
+    double jackpot; // expected jackpot paid at a hit
+    double jackpot_stddev;
+} cycle_t;
+
+static uint64_t PRIZES[10];
+
+typedef struct {
+    uint64_t from;
+    uint16_t rank;
+    uint8_t hold;
+    uint8_t last; // the hold before
+} change_t;
+
+static int change_cmp(const void *a, const void *b) {
+    uint64_t fa = ((const change_t *) a)->from;
+    uint64_t fb = ((const change_t *) b)->from;
+    return fa < fb ? -1 : fa > fb;
+}
+
+static void push_segment(uint64_t from, int64_t rest, int64_t royals) {
+    double den = (double) HAND_COUNT * HOLD_DRAWS_LCM;
+    SEGMENTS[segment_count++] = (segment_t) {from, royals / den, rest / den};
+}
+
+// the changes of hold over all hands sorted by jackpot, summed up as they come
+static void aware_segments(void) {
+    static change_t changes[HAND_COUNT * 32];
+    uint32_t n = 0;
+    int64_t rest = 0;
+    int64_t royals = 0;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t i = JACKPOT_BREAKS_FROM[rank];
+        jackpot_line_t line = jackpot_line(rank, JACKPOT_BREAKS[i].hold, PRIZES);
+        rest += line.rest;
+        royals += line.royals;
+        for (i++; i < JACKPOT_BREAKS_FROM[rank + 1]; i++) {
+            changes[n++] = (change_t) {JACKPOT_BREAKS[i].from, rank, JACKPOT_BREAKS[i].hold, JACKPOT_BREAKS[i - 1].hold};
+        }
+    }
+    qsort(changes, n, sizeof(change_t), change_cmp);
+    uint64_t from = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        if (changes[i].from != from) {
+            push_segment(from, rest, royals);
+            from = changes[i].from;
+        }
+        jackpot_line_t last = jackpot_line(changes[i].rank, changes[i].last, PRIZES);
+        jackpot_line_t line = jackpot_line(changes[i].rank, changes[i].hold, PRIZES);
+        rest += line.rest - last.rest;
+        royals += line.royals - last.royals;
+    }
+    push_segment(from, rest, royals);
+}
+
+// one segment: the strategy holds the same at every jackpot
+static void fixed_segments(const strategy_t *strategy, uint64_t seed) {
+    int64_t rest = 0;
+    int64_t royals = 0;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t hand = hand_unrank(rank);
+        jackpot_line_t line = jackpot_line(rank, hold_bits(hand, strategy->hold(hand, seed)), PRIZES);
+        rest += line.rest;
+        royals += line.royals;
+    }
+    push_segment(0, rest, royals);
+}
+
+// the sums of x^m, m x^m and m^2 x^m for m < n, n 0 for all m
+static void geometric_sums(double x, uint64_t n, double sums[3]) {
+    if (n && n <= 64) {
+        double p = 1;
+        sums[0] = sums[1] = sums[2] = 0;
+        for (uint64_t m = 0; m < n; m++, p *= x) {
+            sums[0] += p;
+            sums[1] += m * p;
+            sums[2] += (double) m * m * p;
+        }
+        return;
+    }
+    double q = 1 - x;
+    double g0 = 1 / q;
+    double g1 = x / (q * q);
+    double g2 = x * (1 + x) / (q * q * q);
+    // less the sums from n on, x^n times the sums of (m + n)^i
+    double xn = n ? pow(x, n) : 0;
+    sums[0] = g0 - xn * g0;
+    sums[1] = g1 - xn * (g1 + n * g0);
+    sums[2] = g2 - xn * (g2 + 2.0 * n * g1 + (double) n * n * g0);
+}
+
+// calls step for every run of rounds with the same segment: the first round k >= 1 of the run, its length
+// (0 for all on), the segment and the chance that the cycle reaches round k; stops when step returns 0
+typedef int (*run_step_t)(void *arg, uint64_t k, uint64_t n, const segment_t *s, double survival);
+
+static void walk_runs(uint64_t seed, uint64_t inc, run_step_t step, void *arg) {
+    double survival = 1;
+    uint64_t k = 1;
+    for (uint32_t i = 0; i < segment_count; i++) {
+        const segment_t *s = &SEGMENTS[i];
+        uint64_t jackpot = seed + inc * k;
+        uint64_t end = i + 1 < segment_count ? SEGMENTS[i + 1].from : UINT64_MAX;
+        if (jackpot >= end) {
+            continue;
+        }
+        // rounds k .. k + n - 1 have jackpots below end
+        uint64_t n = inc == 0 || end == UINT64_MAX ? 0 : (end - jackpot + inc - 1) / inc;
+        if (!step(arg, k, n, s, survival)) {
+            return;
+        }
+        if (n == 0) {
+            return;
+        }
+        survival *= pow(1 - s->royal, n);
+        k += n;
+    }
+}
+
+typedef struct {
+    uint64_t seed;
+    uint64_t inc;
+    double rounds;
+    double rest;
+    double jackpot;
+    double jackpot_squares;
+} cycle_sums_t;
+
+static int cycle_step(void *arg, uint64_t k, uint64_t n, const segment_t *s, double survival) {
+    cycle_sums_t *c = arg;
+    double sums[3];
+    geometric_sums(1 - s->royal, n, sums);
+    // round k + m is reached with survival x^m and pays seed + inc k + inc m at a hit
+    double a = c->seed + (double) c->inc * k;
+    double inc = c->inc;
+    c->rounds += survival * sums[0];
+    c->rest += survival * s->rest * sums[0];
+    c->jackpot += survival * s->royal * (a * sums[0] + inc * sums[1]);
+    c->jackpot_squares += survival * s->royal * (a * a * sums[0] + 2 * a * inc * sums[1] + inc * inc * sums[2]);
+    return 1;
+}
+
+static cycle_t model(uint64_t seed, uint64_t inc) {
+    cycle_sums_t c = {seed, inc};
+    walk_runs(seed, inc, cycle_step, &c);
+    double jackpot = c.jackpot;
+    return (cycle_t) {c.rounds, (c.rest + jackpot) / c.rounds, jackpot, sqrt(c.jackpot_squares - jackpot * jackpot)};
+}
+
+typedef struct {
+    uint64_t seed;
+    uint64_t inc;
+    double p;
+    uint64_t jackpot;
+} quantile_t;
+
+static int quantile_step(void *arg, uint64_t k, uint64_t n, const segment_t *s, double survival) {
+    quantile_t *q = arg;
+    double x = 1 - s->royal;
+    double after = n ? survival * pow(x, n) : 0;
+    if (1 - after < q->p) {
+        return 1;
+    }
+    // the first m with survival x^(m + 1) <= 1 - p
+    double m = ceil(log((1 - q->p) / survival) / log(x)) - 1;
+    q->jackpot = q->seed + q->inc * (k + (uint64_t) (m < 0 ? 0 : m));
+    return 0;
+}
+
+// the smallest jackpot paid at a hit with at least chance p of a hit at or below it
+static uint64_t quantile(uint64_t seed, uint64_t inc, double p) {
+    quantile_t q = {seed, inc, p, UINT64_MAX};
+    walk_runs(seed, inc, quantile_step, &q);
+    return q.jackpot;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: jackpot_model [-s strategy] [-j seed | -j lo:hi] [-i increment | -i lo:hi]\n");
+    for (uint8_t i = 0; i < STRATEGIES_LENGTH; i++) {
+        fprintf(stderr, "  -s %-10s %s\n", STRATEGIES[i].name, STRATEGIES[i].help);
+    }
+    exit(2);
+}
+
+// a value or lo:hi
+static void parse_range(const char *text, uint64_t range[2]) {
+    char *end;
+    range[0] = range[1] = strtoull(text, &end, 10);
+    if (end == text) {
+        usage();
+    }
+    if (*end == ':') {
+        text = end + 1;
+        range[1] = strtoull(text, &end, 10);
+        if (end == text || range[1] < range[0]) {
+            usage();
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const strategy_t *strategy = strategy_find("aware");
+    uint64_t seeds[2] = {PAYOUTS_PRIZES[Royal], PAYOUTS_PRIZES[Royal]};
+    uint64_t incs[2] = {1, 1};
+    int opt;
+    while ((opt = getopt(argc, argv, "s:j:i:")) != -1) {
+        switch (opt) {
+            case 's':
+                strategy = strategy_find(optarg);
+                if (!strategy) {
+                    usage();
+                }
+                break;
+            case 'j':
+                parse_range(optarg, seeds);
+                break;
+            case 'i':
+                parse_range(optarg, incs);
+                break;
+            default:
+                usage();
+        }
+    }
+    // a fixed strategy holds at every seed as at the first
+    int aware = strcmp(strategy->name, "aware") == 0;
+    if (optind < argc || (!aware && seeds[0] != seeds[1])) {
+        usage();
+    }
+    for (uint8_t combi = 0; combi <= Royal; combi++) {
+        PRIZES[combi] = PAYOUTS_PRIZES[combi];
+    }
+
+    double t = now();
+    subsets_init();
+    if (!aware) {
+        if (strategy->init) {
+            strategy->init();
+        }
+        fixed_segments(strategy, seeds[0]);
+    } else {
+        jackpot_init(PRIZES);
+        aware_segments();
+    }
+    double init_time = now() - t;
+    fprintf(stderr, "strategy %s segments %u init %.2fs\n", strategy->name, segment_count, init_time);
+
+    if (seeds[0] == seeds[1] && incs[0] == incs[1]) {
+        uint64_t seed = seeds[0];
+        uint64_t inc = incs[0];
+        cycle_t c = model(seed, inc);
+        printf("seed %llu increment %llu\n", (unsigned long long) seed, (unsigned long long) inc);
+        printf("return    %.9f per round\n", c.returned);
+        printf("cycle     %.3f rounds\n", c.rounds);
+        printf("jackpot   %.3f at a hit, stddev %.3f\n", c.jackpot, c.jackpot_stddev);
+        static const double PS[] = {0.01, 0.05, 0.1, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99, 0.999};
+        for (uint8_t i = 0; i < sizeof(PS) / sizeof(PS[0]); i++) {
+            printf("%5.1f%%    %llu\n", PS[i] * 100, (unsigned long long) quantile(seed, inc, PS[i]));
+        }
+        return 0;
+    }
+    t = now();
+    printf("%8s %6s %12s %12s %12s %12s\n", "seed", "inc", "return", "cycle", "jackpot", "stddev");
+    for (uint64_t seed = seeds[0]; seed <= seeds[1]; seed++) {
+        for (uint64_t inc = incs[0]; inc <= incs[1]; inc++) {
+            cycle_t c = model(seed, inc);
+            printf("%8llu %6llu %12.9f %12.3f %12.3f %12.3f\n", (unsigned long long) seed, (unsigned long long) inc, c.returned, c.rounds, c.jackpot, c.jackpot_stddev);
+        }
+    }
+    double pairs = (double) (seeds[1] - seeds[0] + 1) * (incs[1] - incs[0] + 1);
+    fprintf(stderr, "swept %.0f pairs in %.3fs\n", pairs, now() - t);
+    return 0;
+}
@@ -0,0 +1,74 @@
+// gcc -O2 -Wall -I.. merge_sim.c sim_shard.c -o merge_sim -lm
+//
+// ./merge_sim shard_file...
+//
+// Adds up the shard files of a sim_rtp campaign (-k, -c) and reports as sim_rtp: all files must be of the same
+// strategy, seed, rounds, hands and shards, each shard at most once. The counts are integers, so the merge is
+// exact and does not depend on the order of the files; missing shards and shards not played to the end are
+// listed, the report covers the rounds played.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim_shard.h"
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: merge_sim shard_file...\n");
+        return 2;
+    }
+    sim_shard_t campaign;
+    uint8_t *seen = NULL;
+    sim_counts_t totals = {0};
+    int incomplete = 0;
+    for (int f = 1; f < argc; f++) {
+        sim_shard_t shard;
+        sim_state_t *states;
+        if (!sim_shard_read(argv[f], &shard, &states)) {
+            return 1;
+        }
+        if (f == 1) {
+            campaign = shard;
+            seen = calloc(shard.shards, 1);
+        } else if (strcmp(shard.strategy, campaign.strategy) || shard.seed != campaign.seed ||
+                   shard.rounds != campaign.rounds || shard.hands != campaign.hands || shard.shards != campaign.shards) {
+            fprintf(stderr, "%s: strategy %s seed %llu rounds %llu hands %u shards %u, not the campaign of %s\n", argv[f],
+                    shard.strategy, (unsigned long long) shard.seed, (unsigned long long) shard.rounds, shard.hands,
+                    shard.shards, argv[1]);
+            return 1;
+        }
+        if (seen[shard.shard]) {
+            fprintf(stderr, "%s: shard %u twice\n", argv[f], shard.shard);
+            return 1;
+        }
+        seen[shard.shard] = 1;
+        uint64_t played = 0;
+        uint64_t rounds = 0;
+        for (uint32_t t = 0; t < shard.threads; t++) {
+            sim_counts_add(&totals, &states[t].counts);
+            played += states[t].counts.rounds;
+            rounds += states[t].rounds;
+        }
+        if (played < rounds) {
+            printf("shard %u: %llu of %llu rounds played (%s)\n", shard.shard, (unsigned long long) played,
+                   (unsigned long long) rounds, argv[f]);
+            incomplete++;
+        }
+        free(states);
+    }
+    uint32_t missing = 0;
+    for (uint32_t s = 0; s < campaign.shards; s++) {
+        if (!seen[s]) {
+            printf("shard %u: missing\n", s);
+            missing++;
+        }
+    }
+    free(seen);
+
+    printf("strategy %s rounds %llu of %llu hands %u seed %llu shards %u of %u\n", campaign.strategy,
+           (unsigned long long) totals.rounds, (unsigned long long) campaign.rounds, campaign.hands,
+           (unsigned long long) campaign.seed, campaign.shards - missing, campaign.shards);
+    if (totals.rounds) {
+        sim_report(&totals, campaign.hands);
+    }
+    return missing || incomplete;
+}
@@ -0,0 +1,227 @@
+// gcc -O2 -Wall -pthread -I.. oracle_score.c -o oracle_score
+//
+// ./oracle_score [-t threads] [-v]
+//
+// Brute force check of score(), the native version of countComb/scoreDumb in picolisp/bird.l:
+// every wildcard is expanded into every rank it can stand for (and a suit ace into 1 and 14),
+// each unwilded hand is scored as score-hand-unwilded does, and the best (best-score) is compared
+// with score() for all 6188 hands. -v prints every hand. Exits 1 on a mismatch or when the combination
+// counts differ from the ones recorded in bird.l.
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bird_poker_score.h"
+
+// the combinations of score-hand-unwilded, with FllHs and TwoPr that score() never gives
+enum {
+    D_HighC, D_OnePr, D_TwoPr, D_Trips, D_Strgt, D_Flush, D_FllHs, D_FourK, D_StrFl, D_FiveK, D_Royal, D_COMBIS
+};
+static const char *const DUMB_NAMES[D_COMBIS] = {"HighC", "OnePr", "TwoPr", "Trips", "Strgt", "Flush", "FllHs", "FourK", "StrFl", "FiveK", "Royal"};
+// picolisp values, best-score takes the highest value then the highest rank
+static const uint16_t DUMB_VALUES[D_COMBIS] = {10, 20, 100, 200, 300, 400, 500, 1000, 3000, 4000, 5000};
+// combi of score(), 0 for none
+static const uint8_t DUMB_COMBIS[D_COMBIS] = {HighC, OnePr, 0, Trips, Strgt, Flush, 0, FourK, StrFl, FiveK, Royal};
+
+// combination counts of (countComb) recorded in bird.l
+static const uint32_t RECORDED_COUNTS[10] = {0, 139, 2884, 1327, 1277, 349, 198, 9, 4, 1};
+
+typedef struct {
+    uint8_t combi;
+    uint8_t rank;
+} dumb_score_t;
+
+// score-hand-unwilded, rks sorted low to high
+static dumb_score_t score_unwilded(const uint8_t rks[5], int has_wilds) {
+    int is_flush = !has_wilds;
+    int is_straight = rks[0] + 1 == rks[1] && rks[1] + 1 == rks[2] && rks[2] + 1 == rks[3] && rks[3] + 1 == rks[4];
+    const uint8_t r1 = rks[0], r2 = rks[1], r3 = rks[2], r4 = rks[3], r5 = rks[4];
+    if (is_straight && is_flush && r5 == 14) {
+        return (dumb_score_t) {D_Royal, 0};
+    } else if (r1 == r5) {
+        return (dumb_score_t) {D_FiveK, r1};
+    } else if (is_straight && is_flush) {
+        return (dumb_score_t) {D_StrFl, r5};
+    } else if (r1 == r4 || r2 == r5) {
+        return (dumb_score_t) {D_FourK, r2};
+    } else if ((r1 == r3 && r4 == r5) || (r1 == r2 && r3 == r5)) {
+        return (dumb_score_t) {D_FllHs, r3};
+    } else if (is_flush) {
+        return (dumb_score_t) {D_Flush, r5};
+    } else if (is_straight) {
+        return (dumb_score_t) {D_Strgt, r5};
+    } else if (r1 == r3 || r2 == r4 || r3 == r5) {
+        return (dumb_score_t) {D_Trips, r3};
+    } else if ((r1 == r2 && r3 == r4) || (r1 == r2 && r4 == r5) || (r2 == r3 && r4 == r5)) {
+        return (dumb_score_t) {D_TwoPr, r4};
+    } else if (r1 == r2 || r2 == r3) {
+        return (dumb_score_t) {D_OnePr, r2};
+    } else if (r3 == r4 || r4 == r5) {
+        return (dumb_score_t) {D_OnePr, r4};
+    }
+    return (dumb_score_t) {D_HighC, r5};
+}
+
+static int better(dumb_score_t a, dumb_score_t b) {
+    return DUMB_VALUES[a.combi] > DUMB_VALUES[b.combi] || (a.combi == b.combi && a.rank > b.rank);
+}
+
+// scoreDumb and best-score: expand the hand (gen-hand-explode) and keep the best score
+static dumb_score_t score_dumb(const uint8_t hnd[5], uint32_t *assignments) {
+    uint8_t lows[5];
+    uint8_t highs[5];
+    int has_wilds = 0;
+    for (int i = 0; i < 5; i++) {
+        if (is_wild(hnd[i])) {
+            lows[i] = 1;
+            highs[i] = wildcard_rank(hnd[i]);
+            has_wilds = 1;
+        } else if (hnd[i] == CA) {
+            lows[i] = 1; // 1 and 14, mapped below
+            highs[i] = 2;
+        } else {
+            lows[i] = hnd[i];
+            highs[i] = hnd[i];
+        }
+    }
+    uint8_t at[5];
+    memcpy(at, lows, 5);
+    dumb_score_t best = {D_HighC, 0};
+    uint32_t count = 0;
+    for (;;) {
+        uint8_t rks[5];
+        for (int i = 0; i < 5; i++) {
+            rks[i] = (hnd[i] == CA && at[i] == 2) ? 14 : at[i];
+        }
+        for (int i = 1; i < 5; i++) {
+            uint8_t r = rks[i];
+            int j = i - 1;
+            for (; j >= 0 && rks[j] > r; j--) {
+                rks[j + 1] = rks[j];
+            }
+            rks[j + 1] = r;
+        }
+        dumb_score_t s = score_unwilded(rks, has_wilds);
+        if (count == 0 || better(s, best)) {
+            best = s;
+        }
+        count++;
+        int i = 0;
+        for (; i < 5; i++) {
+            if (at[i] < highs[i]) {
+                at[i]++;
+                break;
+            }
+            at[i] = lows[i];
+        }
+        if (i == 5) {
+            break;
+        }
+    }
+    *assignments = count;
+    return best;
+}
+
+typedef struct {
+    pthread_t thread;
+    uint32_t dumb_counts[D_COMBIS];
+    uint32_t counts[10];
+    uint64_t assignments;
+    uint32_t mismatches;
+} oracle_thread_t;
+
+static uint16_t next_rank = 0;
+static int verbose = 0;
+static pthread_mutex_t print_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void *oracle_run(void *arg) {
+    oracle_thread_t *t = arg;
+    for (;;) {
+        uint16_t rank = __atomic_fetch_add(&next_rank, 1, __ATOMIC_RELAXED);
+        if (rank >= HAND_COUNT) {
+            break;
+        }
+        uint32_t mask = hand_unrank(rank);
+        uint8_t hnd[5];
+        for (int i = 0; i < 5; i++) {
+            hnd[i] = __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+        uint32_t assignments;
+        dumb_score_t dumb = score_dumb(hnd, &assignments);
+        int s = score(hnd[0], hnd[1], hnd[2], hnd[3], hnd[4]);
+        int expect = DUMB_COMBIS[dumb.combi] ? (DUMB_COMBIS[dumb.combi] << 4) | dumb.rank : -1;
+        t->dumb_counts[dumb.combi]++;
+        t->counts[s >> 4]++;
+        t->assignments += assignments;
+        if (s != expect || verbose) {
+            pthread_mutex_lock(&print_lock);
+            printf("%s%d %d %d %d %d scoreDumb %s %d score %s %d\n", s != expect ? "FAIL " : "", hnd[0], hnd[1], hnd[2], hnd[3], hnd[4],
+                   DUMB_NAMES[dumb.combi], dumb.rank, PAYOUTS_NAMES[s >> 4], s & 15);
+            pthread_mutex_unlock(&print_lock);
+        }
+        t->mismatches += s != expect;
+    }
+    return NULL;
+}
+
+int main(int argc, char *argv[]) {
+    int threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int opt;
+    while ((opt = getopt(argc, argv, "t:v")) != -1) {
+        switch (opt) {
+            case 't':
+                threads = atoi(optarg);
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: oracle_score [-t threads] [-v]\n");
+                return 2;
+        }
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    oracle_thread_t *ts = calloc(threads, sizeof(oracle_thread_t));
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&ts[i].thread, NULL, oracle_run, &ts[i]);
+    }
+    uint32_t dumb_counts[D_COMBIS] = {0};
+    uint32_t counts[10] = {0};
+    uint64_t assignments = 0;
+    uint32_t mismatches = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ts[i].thread, NULL);
+        for (int c = 0; c < D_COMBIS; c++) {
+            dumb_counts[c] += ts[i].dumb_counts[c];
+        }
+        for (int c = 0; c < 10; c++) {
+            counts[c] += ts[i].counts[c];
+        }
+        assignments += ts[i].assignments;
+        mismatches += ts[i].mismatches;
+    }
+    free(ts);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    int count_fails = 0;
+    printf("combi  scoreDumb     score  recorded\n");
+    for (int c = D_COMBIS - 1; c >= 0; c--) {
+        uint8_t combi = DUMB_COMBIS[c];
+        uint32_t recorded = combi ? RECORDED_COUNTS[combi] : 0;
+        uint32_t scored = combi ? counts[combi] : 0;
+        int ok = dumb_counts[c] == recorded && scored == recorded;
+        count_fails += !ok;
+        printf("%-5s %10u %9u %9u%s\n", DUMB_NAMES[c], dumb_counts[c], scored, recorded, ok ? "" : " FAIL");
+    }
+    printf("%d hands %llu assignments %u mismatches %d threads %.1f ms\n", HAND_COUNT, (unsigned long long) assignments, mismatches, threads,
+           (t1.tv_sec - t0.tv_sec) * 1e3 + (t1.tv_nsec - t0.tv_nsec) * 1e-6);
+    return (mismatches || count_fails) ? 1 : 0;
+}
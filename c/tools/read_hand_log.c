@@ -0,0 +1,115 @@
+// gcc -O2 -Wall -I.. read_hand_log.c hand_log.c -o read_hand_log
+//
+// ./read_hand_log [-p] [-c] log...
+//
+// Reads hand logs (hand_log.h) as written by replay_face -l and sim_rtp -l, through mmap with the rounds
+// decoded in place, and reports the rounds, blocks, damaged blocks, whether the file ends in a short block,
+// the bytes a round, the read speed, the coins in and prizes out, the combis and the balance and jackpot
+// after the last round. -p prints every round: the dealt cards, the held ones, the redrawn ones, the score,
+// the prize, hands, balance and jackpot. -c rebuilds the final hand of every round from the deal, hold and
+// redraw and checks its score.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "hand_log.h"
+#include "bird_poker_score_table.h"
+
+static const char CARD_CHARS[] = {' ', 'A', '2', '3', '4', '5', '6', '7', '8', '9', 'T', 'J', 'Q', 'K', 'f', 'r', 't', 'k'};
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void print_cards(uint32_t mask) {
+    char text[6] = {0};
+    for (uint8_t i = 0; mask; i++, mask &= mask - 1) {
+        text[i] = CARD_CHARS[__builtin_ctz(mask)];
+    }
+    printf(" %-5s", text);
+}
+
+// the final hand of round
+static uint32_t final_hand(const bird_poker_round_t *round) {
+    uint32_t dealt = hand_unrank(round->deal);
+    return hold_cards(dealt, round->hold) | log_redraw_unrank(dealt, 5 - __builtin_popcount(round->hold), round->redraw);
+}
+
+int main(int argc, char *argv[]) {
+    int print = 0;
+    int check = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "pc")) != -1) {
+        switch (opt) {
+            case 'p':
+                print = 1;
+                break;
+            case 'c':
+                check = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: read_hand_log [-p] [-c] log...\n");
+                return 2;
+        }
+    }
+    if (optind == argc) {
+        fprintf(stderr, "usage: read_hand_log [-p] [-c] log...\n");
+        return 2;
+    }
+    int failed = 0;
+    for (int f = optind; f < argc; f++) {
+        hand_log_reader_t r;
+        if (!hand_log_open(argv[f], &r)) {
+            failed = 1;
+            continue;
+        }
+        uint64_t rounds = 0;
+        uint64_t coins = 0;
+        uint64_t paid = 0;
+        uint64_t combis[10] = {0};
+        uint64_t mismatches = 0;
+        bird_poker_round_t round;
+        double t = now();
+        while (hand_log_next(&r, &round)) {
+            rounds++;
+            coins += round.hands;
+            paid += round.prize;
+            combis[round.score >> 4]++;
+            if (check && SCORE_TABLE[hand_rank(final_hand(&round))] != round.score) {
+                mismatches++;
+            }
+            if (print) {
+                uint32_t dealt = hand_unrank(round.deal);
+                uint32_t held = hold_cards(dealt, round.hold);
+                printf("%8llu", (unsigned long long) rounds);
+                print_cards(dealt);
+                print_cards(held);
+                print_cards(final_hand(&round) & ~held);
+                printf(" %s %2d %8llu %3u %12lld %12llu\n", PAYOUTS_NAMES[round.score >> 4], round.score & 15,
+                       (unsigned long long) round.prize, round.hands, (long long) round.balance,
+                       (unsigned long long) round.jackpot);
+            }
+        }
+        double elapsed = now() - t;
+
+        printf("%s: %llu rounds in %llu blocks, %llu damaged%s\n", argv[f], (unsigned long long) rounds,
+               (unsigned long long) r.blocks, (unsigned long long) r.damaged, r.torn ? ", ends in a short block" : "");
+        printf("%zu bytes, %.2f a round, read in %.3fs %.2f GB/s %.1f Mrounds/s\n", r.size, rounds ? (double) r.size / rounds : 0,
+               elapsed, r.size / elapsed / 1e9, rounds / elapsed / 1e6);
+        printf("coins %llu paid %llu return %.6f balance %lld jackpot %llu\n", (unsigned long long) coins,
+               (unsigned long long) paid, coins ? (double) paid / coins : 0, (long long) r.balance, (unsigned long long) r.jackpot);
+        for (int combi = Royal; combi >= HighC; combi--) {
+            printf("%-5s %12llu\n", PAYOUTS_NAMES[combi], (unsigned long long) combis[combi]);
+        }
+        if (check) {
+            printf("score mismatches %llu\n", (unsigned long long) mismatches);
+            failed |= mismatches != 0;
+        }
+        failed |= r.damaged != 0;
+        hand_log_unmap(&r);
+    }
+    return failed;
+}
@@ -0,0 +1,254 @@
+// gcc -O2 -Wall -DBIRD_POKER_LOG -I.. -I../host replay_face.c ../bird_poker_face.c ../host/host_watch.c hand_log.c -o replay_face
+//
+// ./replay_face [-n events] [-S seed] [-f events_file] [-o events_file] [-b backup_file] [-l hand_log] [-p]
+//
+// Replays an event stream through bird_poker_face_loop at full speed and reports the latency per event,
+// the pixel writes per event and the tick frequency changes, by event and by the screen the event hit.
+// Without -f the stream is synthetic: mostly ticks with random light and alarm button presses.
+// Stream files have one event per line: activate, tick, light, alarm, timeout, low_energy or alarm_long
+// (the long press that preselects the best hold), # comments. An activate after the first resigns the face
+// and activates it again, as the movement does when the player leaves the face and comes back.
+// -o writes the played stream, -p draws the LCD after every event.
+// -b keeps the backup registers in backup_file: a run that stops mid round resumes it in the next run with -b,
+// as the face would after a reset. -l writes the rounds the face settles to hand_log, see hand_log.h.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bird_poker_face.h"
+#include "host_watch.h"
+#include "hand_log.h"
+
+#define EVENT_KINDS 7
+static const char *const EVENT_NAMES[EVENT_KINDS] = {"activate", "tick", "light", "alarm", "timeout", "low_energy", "alarm_long"};
+static const uint8_t EVENT_TYPES[EVENT_KINDS] = {EVENT_ACTIVATE, EVENT_TICK, EVENT_LIGHT_BUTTON_UP, EVENT_ALARM_BUTTON_UP, EVENT_TIMEOUT, EVENT_LOW_ENERGY_UPDATE, EVENT_ALARM_LONG_PRESS};
+
+#define SCREENS 64
+#define LATENCY_BUCKETS 24 // log2 ns
+
+typedef struct {
+    uint64_t count;
+    uint64_t ns;
+    uint64_t ns_max;
+    uint64_t pixel_writes;
+    uint64_t pixel_writes_max;
+    uint64_t clears;
+    uint64_t tick_frequency_changes;
+    uint64_t latency_buckets[LATENCY_BUCKETS];
+} event_stats_t;
+
+static event_stats_t by_event[EVENT_KINDS];
+static event_stats_t by_screen[SCREENS];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void add_stats(event_stats_t *stats, uint64_t ns, uint64_t pixel_writes, uint64_t clears, uint64_t tick_frequency_changes) {
+    stats->count++;
+    stats->ns += ns;
+    stats->ns_max = ns > stats->ns_max ? ns : stats->ns_max;
+    stats->pixel_writes += pixel_writes;
+    stats->pixel_writes_max = pixel_writes > stats->pixel_writes_max ? pixel_writes : stats->pixel_writes_max;
+    stats->clears += clears;
+    stats->tick_frequency_changes += tick_frequency_changes;
+    uint8_t bucket = ns ? 63 - __builtin_clzll(ns) : 0;
+    stats->latency_buckets[bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1]++;
+}
+
+// ns below which p of the events fall, from the histogram
+static uint64_t percentile(const event_stats_t *stats, double p) {
+    uint64_t seen = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += stats->latency_buckets[i];
+        if (seen >= p * stats->count) {
+            return 2ull << i;
+        }
+    }
+    return 2ull << (LATENCY_BUCKETS - 1);
+}
+
+static void print_stats(const char *name, const event_stats_t *stats) {
+    printf("%-11s %9llu %8.0f %8llu %8llu %8llu %10.2f %8llu %8llu %8llu\n", name,
+           (unsigned long long) stats->count, (double) stats->ns / stats->count,
+           (unsigned long long) percentile(stats, 0.5), (unsigned long long) percentile(stats, 0.99), (unsigned long long) stats->ns_max,
+           (double) stats->pixel_writes / stats->count, (unsigned long long) stats->pixel_writes_max,
+           (unsigned long long) stats->clears, (unsigned long long) stats->tick_frequency_changes);
+}
+
+static void print_histogram(const char *name, const event_stats_t *stats) {
+    printf("%s\n", name);
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        if (stats->latency_buckets[i]) {
+            printf("  < %8llu ns %9llu %6.2f%%\n", 2ull << i, (unsigned long long) stats->latency_buckets[i], 100.0 * stats->latency_buckets[i] / stats->count);
+        }
+    }
+}
+
+static int parse_event(const char *word) {
+    for (int kind = 0; kind < EVENT_KINDS; kind++) {
+        if (strcmp(word, EVENT_NAMES[kind]) == 0) {
+            return kind;
+        }
+    }
+    return -1;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: replay_face [-n events] [-S seed] [-f events_file] [-o events_file] [-b backup_file] [-l hand_log] [-p]\n");
+    exit(2);
+}
+
+int main(int argc, char *argv[]) {
+    uint64_t events = 1000000;
+    uint64_t seed = 1;
+    FILE *in = NULL;
+    FILE *record = NULL;
+    const char *backup = NULL;
+    const char *log_path = NULL;
+    int print_lcd = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:S:f:o:b:l:p")) != -1) {
+        switch (opt) {
+            case 'n':
+                events = strtoull(optarg, NULL, 10);
+                break;
+            case 'S':
+                seed = strtoull(optarg, NULL, 10);
+                break;
+            case 'f':
+                in = strcmp(optarg, "-") ? fopen(optarg, "r") : stdin;
+                if (!in) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+            case 'o':
+                record = fopen(optarg, "w");
+                if (!record) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+            case 'b':
+                backup = optarg;
+                break;
+            case 'l':
+                log_path = optarg;
+                break;
+            case 'p':
+                print_lcd = 1;
+                break;
+            default:
+                usage();
+        }
+    }
+
+    host_watch_seed(seed);
+    host_watch_backup_file(backup);
+    if (log_path) {
+        hand_log_face = hand_log_create(log_path);
+        if (!hand_log_face) {
+            perror(log_path);
+            return 1;
+        }
+    }
+    movement_settings_t settings = {0};
+    void *context = NULL;
+    bird_poker_face_setup(&settings, 0, &context);
+    bird_poker_face_activate(&settings, context);
+    bird_poker_face_state_t *state = context;
+
+    uint64_t stream = seed * 0x9E3779B97F4A7C15ull + 1; // synthetic stream, separate from the cards
+    char line[64];
+    uint64_t played = 0;
+    for (;;) {
+        int kind;
+        if (in) {
+            if (!fgets(line, sizeof(line), in)) {
+                break;
+            }
+            char word[32];
+            if (sscanf(line, "%31s", word) != 1 || word[0] == '#') {
+                continue;
+            }
+            kind = parse_event(word);
+            if (kind < 0) {
+                fprintf(stderr, "unknown event: %s\n", word);
+                return 1;
+            }
+        } else {
+            if (played == events) {
+                break;
+            }
+            stream ^= stream << 13;
+            stream ^= stream >> 7;
+            stream ^= stream << 17;
+            uint8_t r = stream % 10;
+            kind = played == 0 ? 0 : (r < 8 ? 1 : (r == 8 ? 2 : 3));
+        }
+        if (record) {
+            fprintf(record, "%s\n", EVENT_NAMES[kind]);
+        }
+
+        movement_event_t event = {.event_type = EVENT_TYPES[kind], .subsecond = 0};
+        if (event.event_type == EVENT_ACTIVATE && played) {
+            // the player left the face and came back
+            bird_poker_face_resign(&settings, context);
+            bird_poker_face_activate(&settings, context);
+        }
+        uint8_t screen = state->screen;
+        host_watch_t before = host_watch;
+        uint64_t t = now_ns();
+        bird_poker_face_loop(event, &settings, context);
+        uint64_t ns = now_ns() - t;
+        uint64_t pixel_writes = host_watch.pixel_writes - before.pixel_writes;
+        uint64_t clears = host_watch.clears - before.clears;
+        uint64_t tick_frequency_changes = host_watch.tick_frequency_changes - before.tick_frequency_changes;
+        add_stats(&by_event[kind], ns, pixel_writes, clears, tick_frequency_changes);
+        add_stats(&by_screen[screen % SCREENS], ns, pixel_writes, clears, tick_frequency_changes);
+        played++;
+
+        if (print_lcd) {
+            printf("%s screen %d -> %d, %llu ns, %llu pixel writes, tick %d Hz\n", EVENT_NAMES[kind], screen, state->screen,
+                   (unsigned long long) ns, (unsigned long long) pixel_writes, host_watch.tick_frequency);
+            host_watch_print(stdout);
+        }
+    }
+    bird_poker_face_resign(&settings, context);
+
+    printf("events %llu seed %llu tick frequency changes %llu of %llu requests backup writes %llu\n", (unsigned long long) played,
+           (unsigned long long) seed, (unsigned long long) host_watch.tick_frequency_changes,
+           (unsigned long long) host_watch.tick_frequency_requests, (unsigned long long) host_watch.backup_writes);
+    printf("%-11s %9s %8s %8s %8s %8s %10s %8s %8s %8s\n", "event", "count", "mean ns", "p50 <", "p99 <", "max ns", "pixels", "max px", "clears", "freq chg");
+    for (int kind = 0; kind < EVENT_KINDS; kind++) {
+        if (by_event[kind].count) {
+            print_stats(EVENT_NAMES[kind], &by_event[kind]);
+        }
+    }
+    printf("%-11s\n", "screen");
+    for (int screen = 0; screen < SCREENS; screen++) {
+        if (by_screen[screen].count) {
+            char name[16];
+            snprintf(name, sizeof(name), "%d", screen);
+            print_stats(name, &by_screen[screen]);
+        }
+    }
+    printf("latency\n");
+    for (int kind = 0; kind < EVENT_KINDS; kind++) {
+        if (by_event[kind].count) {
+            print_histogram(EVENT_NAMES[kind], &by_event[kind]);
+        }
+    }
+    if (record) {
+        fclose(record);
+    }
+    if (hand_log_face && !hand_log_close(hand_log_face)) {
+        perror(log_path);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,396 @@
+// gcc -O2 -Wall -pthread -I.. ruin.c subsets.c jackpot.c strategy.c -o ruin -lm
+//
+// ./ruin [-s strategy] [-j royal] [-b balance | -b lo:hi] [-n rounds] [-t threads] [paytable]
+//
+// Exact risk of ruin of the face: from a balance (default 20, what SCREEN_BUST resets to) a round costs a
+// coin and pays its prize, the session ends when the balance is 0 at a deal. For every starting balance
+// prints the chance to bust, the distribution of the rounds until then and of the peak balance of a session
+// that busts. With a range of balances, one line per balance, the balances spread over the threads.
+//
+// The prizes of a round are independent with the chances of the combis under the strategy (default aware)
+// from the hold counts of subsets.h. The paytable (10 prizes as exact_rtp, default PAYOUTS_PRIZES) pays them,
+// its Royal a fixed royal, -j overrides it: jackpot_model has the jackpot as it grows. -s aware holds the
+// best for the paytable and royal from the breaks of jackpot.h, the other strategies hold as they do for
+// PAYOUTS_PRIZES. A round takes at most one coin, so
+// - a balance of b busts when each of b coins is lost for good, with chance q^b: q the smallest root of
+//   q = sum of P(prize) q^prize, as the extinction of a branching process with the prizes as offspring.
+//   When a round returns at most its coin on average q is 1, every session busts
+// - the rounds until the bust are a banded walk over the balances 1 to a cap, from where a bust is below
+//   2^-50 (q^cap), or with q 1 from where getting any higher has a chance below 2^-50: the chances move down
+//   by 1 or up by a prize - 1 every round, until what is left is as small or for -n rounds (default 1000000).
+//   A return close to 1 makes the walk wide and long, -n stops it sooner: the bust is then the one within the
+//   rounds walked, the quantiles it doesn't reach print as more than them
+// - the peak follows from the scale function W of the walk: from b, a bust before any balance >= m has
+//   chance W(m - 1 - b) / W(m - 1), where W(0) = 1, W < 0 is 0 and W is harmonic for the walk reversed
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bird_poker_hold_table.h"
+#include "jackpot.h"
+#include "strategy.h"
+
+#define EPSILON 0x1p-50
+
+// the prizes of a round and their chances, distinct prizes
+static uint64_t PRIZES[10];
+static double CHANCES[10];
+static uint8_t prize_count;
+static double q;
+static uint32_t cap;
+
+// the log of the scale function W(0) .. W(scale_count - 1)
+static double *LOG_W;
+static uint32_t scale_count;
+
+typedef struct {
+    uint32_t balance;
+    double bust;
+    double rounds; // the mean of the rounds of a busting session
+    uint64_t round_quantiles[3]; // of the rounds of a busting session, 50%, 90%, 99%
+    uint64_t peak_quantiles[3]; // of the peak of a busting session
+    double bust_within[3]; // in 10, 100, 1000 rounds
+    uint64_t walked; // the rounds the walk took
+} ruin_t;
+
+static const double QUANTILES[3] = {0.5, 0.9, 0.99};
+static const uint32_t WITHIN[3] = {10, 100, 1000};
+
+static uint64_t max_rounds = 1000000;
+
+// aware holds the best for prizes from the breaks of jackpot.h, else strategy holds
+static void round_chances(const strategy_t *strategy, int aware, const uint64_t prizes[10]) {
+    double combis[10] = {0};
+    double den = (double) HAND_COUNT * HOLD_DRAWS_LCM;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t hand = hand_unrank(rank);
+        uint8_t hold = aware ? jackpot_hold(rank, prizes[Royal]) : hold_bits(hand, strategy->hold(hand, prizes[Royal]));
+        uint32_t weight = HOLD_DRAWS_LCM / HOLD_DRAWS[__builtin_popcount(hold)];
+        for (uint8_t combi = HighC; combi <= Royal; combi++) {
+            combis[combi] += HOLD_COUNTS[rank][hold][combi] * weight / den;
+        }
+    }
+    for (uint8_t combi = HighC; combi <= Royal; combi++) {
+        uint64_t prize = prizes[combi];
+        uint8_t i = 0;
+        while (i < prize_count && PRIZES[i] != prize) {
+            i++;
+        }
+        if (i == prize_count) {
+            PRIZES[prize_count++] = prize;
+        }
+        CHANCES[i] += combis[combi];
+    }
+}
+
+// the smallest root of q = G(q) by iterating G from 0, it goes up to it
+static double extinction(void) {
+    double s = 0;
+    for (int i = 0; i < 100000; i++) {
+        double g = 0;
+        for (uint8_t j = 0; j < prize_count; j++) {
+            g += CHANCES[j] * pow(s, PRIZES[j]);
+        }
+        if (g - s < 1e-17) {
+            return g;
+        }
+        s = g;
+    }
+    return s;
+}
+
+// With q 1, the cap from where getting cap higher has a chance below EPSILON. For theta > 0 with
+// E[e^(theta (prize - 1))] <= 1, e^(theta balance) is a supermartingale and the chance is at most
+// e^-(theta cap); theta is the largest such one by bisection, 0 when there is none.
+static double climb_theta(void) {
+    double lo = 0;
+    double hi = 1;
+    for (uint8_t i = 0; i < 200; i++) {
+        double theta = (lo + hi) / 2;
+        double m = 0;
+        for (uint8_t j = 0; j < prize_count; j++) {
+            m += CHANCES[j] * exp(theta * ((double) PRIZES[j] - 1));
+        }
+        if (m <= 1) {
+            lo = theta;
+        } else {
+            hi = theta;
+        }
+    }
+    return lo;
+}
+
+// W(y + 1) from W(y) = P(0) W(y + 1) + sum of P(prize) W(y + 1 - prize), kept below 2^500 by a scale that
+// goes to LOG_W
+static void scale_function(uint32_t count) {
+    double zero = 0;
+    uint64_t reach = 0;
+    for (uint8_t j = 0; j < prize_count; j++) {
+        if (PRIZES[j] == 0) {
+            zero = CHANCES[j];
+        } else if (PRIZES[j] > reach) {
+            reach = PRIZES[j];
+        }
+    }
+    double *w = calloc(count, sizeof(double));
+    LOG_W = malloc(count * sizeof(double));
+    double log_scale = 0;
+    w[0] = 1;
+    LOG_W[0] = 0;
+    for (uint32_t y = 0; y + 1 < count; y++) {
+        double sum = 0;
+        for (uint8_t j = 0; j < prize_count; j++) {
+            if (PRIZES[j] && y + 1 >= PRIZES[j]) {
+                sum += CHANCES[j] * w[y + 1 - PRIZES[j]];
+            }
+        }
+        w[y + 1] = (w[y] - sum) / zero;
+        if (w[y + 1] > 0x1p500) {
+            // older ones only matter within reach
+            for (uint32_t i = y + 1 > reach ? y + 1 - reach : 0; i <= y + 1; i++) {
+                w[i] *= 0x1p-500;
+            }
+            log_scale += 500 * log(2);
+        }
+        LOG_W[y + 1] = log(w[y + 1]) + log_scale;
+    }
+    free(w);
+    scale_count = count;
+}
+
+// the chance of a bust before any balance >= peak from balance, peak > balance
+static double bust_below(uint32_t balance, uint32_t peak) {
+    if (peak - 1 >= scale_count) {
+        return pow(q, balance);
+    }
+    return exp(LOG_W[peak - 1 - balance] - LOG_W[peak - 1]);
+}
+
+static void ruin(ruin_t *r) {
+    uint32_t balance = r->balance;
+    // the balances 1 .. top - 1, from top on a bust is below EPSILON
+    uint32_t top = balance + cap;
+    double *now = calloc(top, sizeof(double));
+    double *next = calloc(top, sizeof(double));
+    now[balance] = 1;
+    double busted = 0;
+    double rounds = 0;
+    double live = 1;
+    uint8_t quantile = 0;
+    uint8_t within = 0;
+    double bust = pow(q, balance);
+    uint64_t t;
+    for (t = 1; t <= max_rounds && live > EPSILON * bust; t++) {
+        double bust_now = now[1] * CHANCES[0];
+        memset(next, 0, top * sizeof(double));
+        live = 0;
+        for (uint32_t b = 1; b < top; b++) {
+            if (now[b] == 0) {
+                continue;
+            }
+            for (uint8_t j = 0; j < prize_count; j++) {
+                uint64_t to = b + PRIZES[j] - 1;
+                if (to > 0 && to < top) {
+                    next[to] += now[b] * CHANCES[j];
+                    live += now[b] * CHANCES[j];
+                }
+            }
+        }
+        busted += bust_now;
+        rounds += t * bust_now;
+        for (; quantile < 3 && busted >= QUANTILES[quantile] * bust; quantile++) {
+            r->round_quantiles[quantile] = t;
+        }
+        for (; within < 3 && WITHIN[within] == t; within++) {
+            r->bust_within[within] = busted;
+        }
+        double *swap = now;
+        now = next;
+        next = swap;
+    }
+    for (; within < 3; within++) {
+        r->bust_within[within] = busted;
+    }
+    r->walked = t - 1;
+    r->bust = busted;
+    r->rounds = rounds / busted;
+    // the smallest peak with at least the chance of a bust below it
+    uint8_t i = 0;
+    for (uint32_t peak = balance; i < 3 && peak < scale_count; peak++) {
+        for (; i < 3 && bust_below(balance, peak + 1) >= QUANTILES[i] * bust; i++) {
+            r->peak_quantiles[i] = peak;
+        }
+    }
+    free(now);
+    free(next);
+}
+
+typedef struct {
+    pthread_t thread;
+} ruin_thread_t;
+
+static ruin_t *results;
+static uint32_t result_count;
+static uint32_t next_result = 0;
+
+static void *ruin_run(void *arg) {
+    (void) arg;
+    for (;;) {
+        uint32_t i = __atomic_fetch_add(&next_result, 1, __ATOMIC_RELAXED);
+        if (i >= result_count) {
+            break;
+        }
+        ruin(&results[i]);
+    }
+    return NULL;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: ruin [-s strategy] [-j royal] [-b balance | -b lo:hi] [-n rounds] [-t threads] [paytable]\n");
+    for (uint8_t i = 0; i < STRATEGIES_LENGTH; i++) {
+        fprintf(stderr, "  -s %-10s %s\n", STRATEGIES[i].name, STRATEGIES[i].help);
+    }
+    exit(2);
+}
+
+int main(int argc, char *argv[]) {
+    const strategy_t *strategy = strategy_find("aware");
+    uint64_t royal = 0;
+    uint32_t balances[2] = {20, 20};
+    int threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int opt;
+    while ((opt = getopt(argc, argv, "s:j:b:n:t:")) != -1) {
+        switch (opt) {
+            case 's':
+                strategy = strategy_find(optarg);
+                if (!strategy) {
+                    usage();
+                }
+                break;
+            case 'j':
+                royal = strtoull(optarg, NULL, 10);
+                break;
+            case 'b':
+                if (sscanf(optarg, "%u:%u", &balances[0], &balances[1]) == 1) {
+                    balances[1] = balances[0];
+                }
+                break;
+            case 'n':
+                max_rounds = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                threads = atoi(optarg);
+                break;
+            default:
+                usage();
+        }
+    }
+    uint64_t prizes[10];
+    for (uint8_t combi = 0; combi <= Royal; combi++) {
+        prizes[combi] = PAYOUTS_PRIZES[combi];
+    }
+    if (royal) {
+        prizes[Royal] = royal;
+    }
+    if (optind + 1 < argc || (optind < argc && !parse_paytable(argv[optind], royal, prizes)) || threads < 1 ||
+        balances[0] < 1 || balances[1] < balances[0] || prizes[Royal] < 1) {
+        usage();
+    }
+    royal = prizes[Royal];
+
+    double t = now();
+    subsets_init();
+    int aware = strcmp(strategy->name, "aware") == 0;
+    if (aware) {
+        jackpot_init(prizes);
+    } else if (strategy->init) {
+        strategy->init();
+    }
+    round_chances(strategy, aware, prizes);
+    // the walk needs to go down
+    if (PRIZES[0] != 0) {
+        fprintf(stderr, "no round loses its coin\n");
+        return 1;
+    }
+    double mean = 0;
+    for (uint8_t j = 0; j < prize_count; j++) {
+        mean += CHANCES[j] * PRIZES[j];
+    }
+    double cap_balances;
+    if (mean <= 1) {
+        q = 1;
+        cap_balances = ceil(-log(EPSILON) / climb_theta());
+    } else {
+        q = extinction();
+        cap_balances = q < 1 ? ceil(log(EPSILON) / log(q)) : INFINITY;
+    }
+    if (!(cap_balances <= 10000000)) {
+        fprintf(stderr, "q %.9f mean prize %.9f: the walk needs a cap above 10000000\n", q, mean);
+        return 1;
+    }
+    cap = cap_balances;
+    scale_function(balances[1] + cap + 2);
+    double init_time = now() - t;
+
+    result_count = balances[1] - balances[0] + 1;
+    results = calloc(result_count, sizeof(ruin_t));
+    for (uint32_t i = 0; i < result_count; i++) {
+        results[i].balance = balances[0] + i;
+    }
+    t = now();
+    ruin_thread_t *ts = calloc(threads, sizeof(ruin_thread_t));
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&ts[i].thread, NULL, ruin_run, &ts[i]);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ts[i].thread, NULL);
+    }
+    double run_time = now() - t;
+    free(ts);
+
+    printf("strategy %s royal %llu q %.12f cap %u\n", strategy->name, (unsigned long long) royal, q, cap);
+    printf("prize");
+    for (uint8_t j = 0; j < prize_count; j++) {
+        printf(" %llu:%.9f", (unsigned long long) PRIZES[j], CHANCES[j]);
+    }
+    printf("\n");
+    if (result_count == 1) {
+        const ruin_t *r = &results[0];
+        printf("balance   %u\n", r->balance);
+        printf("bust      %.12f, q^balance %.12f\n", r->bust, pow(q, r->balance));
+        printf("rounds    %.3f on average to bust, walked %llu\n", r->rounds, (unsigned long long) r->walked);
+        for (uint8_t i = 0; i < 3; i++) {
+            if (r->round_quantiles[i]) {
+                printf("          %llu for %.0f%% of the busts\n", (unsigned long long) r->round_quantiles[i], QUANTILES[i] * 100);
+            } else {
+                printf("          more than %llu for %.0f%% of the busts\n", (unsigned long long) r->walked, QUANTILES[i] * 100);
+            }
+        }
+        for (uint8_t i = 0; i < 3; i++) {
+            printf("bust      %.12f within %u rounds\n", r->bust_within[i], WITHIN[i]);
+        }
+        for (uint8_t i = 0; i < 3; i++) {
+            printf("peak      %llu or less for %.0f%% of the busts\n", (unsigned long long) r->peak_quantiles[i], QUANTILES[i] * 100);
+        }
+    } else {
+        printf("%8s %14s %10s %8s %8s %8s %8s %8s %8s\n", "balance", "bust", "rounds", "r50%", "r90%", "r99%", "peak50%", "peak90%", "peak99%");
+        for (uint32_t i = 0; i < result_count; i++) {
+            const ruin_t *r = &results[i];
+            printf("%8u %14.12f %10.3f %8llu %8llu %8llu %8llu %8llu %8llu\n", r->balance, r->bust, r->rounds,
+                   (unsigned long long) r->round_quantiles[0], (unsigned long long) r->round_quantiles[1],
+                   (unsigned long long) r->round_quantiles[2], (unsigned long long) r->peak_quantiles[0],
+                   (unsigned long long) r->peak_quantiles[1], (unsigned long long) r->peak_quantiles[2]);
+        }
+    }
+    fprintf(stderr, "init %.3fs run %.3fs %u balances\n", init_time, run_time, result_count);
+    return 0;
+}
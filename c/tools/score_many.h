@@ -0,0 +1,22 @@
+#ifndef bird_poker_SCORE_MANY_H_
+#define bird_poker_SCORE_MANY_H_
+
+// Batch scoring on the host, structure of arrays:
+// card k (0..4) of hand i is hands[k * n + i], out[i] is the packed (combi << 4) | highc of score()
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SCORE_MANY_SCALAR 0
+#define SCORE_MANY_AVX2 1
+#define SCORE_MANY_PATHS 2
+
+// scores with the best path the cpu supports
+void score_many(const uint8_t *hands, size_t n, uint8_t *out);
+
+// scores with the given path, returns 0 without scoring when the cpu doesn't support it
+int score_many_with(int path, const uint8_t *hands, size_t n, uint8_t *out);
+
+const char *score_many_path_name(int path);
+
+#endif // bird_poker_SCORE_MANY_H_
@@ -0,0 +1,337 @@
+// gcc -O2 -Wall -pthread -I.. search_paytable.c subsets.c -o search_paytable -lm
+//
+// ./search_paytable [-t threads] [-j royal] [-r return] [-d tolerance] [-v stddev_lo:stddev_hi] [-n count] [ranges]
+//
+// Searches integer paytables for the ones that hit a target return (default 2) within the tolerance (default
+// 0.01) and a stddev band of one round (default any), under optimal play as exact_rtp. ranges are 10 entries
+// in the layout of PAYOUTS_PRIZES, each a prize or lo:hi, default 0,0,0,0:2,0:4,1:6,1:8,2:15,10:40,250.
+// Only tables with prizes that don't decrease from HighC to Royal are evaluated, -j fixes the Royal (the
+// starting jackpot it pays). Prints the -n (default 10) tables closest to the target, then by lower stddev.
+//
+// The combi counts of every hold of every dealt hand (HOLD_COUNTS of subsets.h) are shared by all candidates
+// and threads. The holds that one scanned before pays at least as much as under any such table are dropped
+// once at startup (12.4 of 32 are left), the rest weighed by their draws so that their prize totals under a
+// table follow from the last candidate's with a pass for every prize that differs.
+// The candidates are numbered in mixed radix of the ranges and split over the threads by bird_poker_ranges.h.
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bird_poker_score.h"
+#include "bird_poker_ranges.h"
+#include "subsets.h"
+
+#define MAX_RESULTS 100
+
+// the holds of every dealt hand that can be its first best, highest first as exact_rtp scans them:
+// rank has the holds HOLD_FROM[rank] to HOLD_FROM[rank + 1] - 1, with their counts by combi times
+// HOLD_DRAWS_LCM / draws in WEIGHTED[combi], so that their prize totals compare and add up as they are
+static uint32_t HOLD_FROM[HAND_COUNT + 1];
+static uint16_t WEIGHTED[10][HAND_COUNT * 32];
+
+typedef struct {
+    uint32_t prizes[10];
+    double returned;
+    double stddev;
+    double hit_rate;
+} result_t;
+
+typedef struct {
+    pthread_t thread;
+    uint64_t evaluated;
+    uint64_t matched;
+    uint8_t result_count;
+    result_t results[MAX_RESULTS];
+} search_thread_t;
+
+static uint32_t LO[10];
+static uint32_t HI[10];
+static double target = 2;
+static double tolerance = 0.01;
+static double stddev_lo = 0;
+static double stddev_hi = INFINITY;
+static int result_max = 10;
+static int thread_count;
+static search_thread_t *threads;
+static ranges_t work; // the candidates, a range per thread
+
+// tails[t] the redraws of the hold with combi t or better
+static void hold_tails(uint16_t rank, uint8_t hold, uint32_t tails[10]) {
+    uint32_t tail = 0;
+    for (int8_t combi = Royal; combi >= HighC; combi--) {
+        tail += HOLD_COUNTS[rank][hold][combi];
+        tails[combi] = tail;
+    }
+}
+
+// drops a hold b when a hold a scanned before it has at least its chance of every combi or better: with
+// prizes that don't decrease a then pays at least as much, so b is never the first best
+static void prune_holds(void) {
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t tails[32][10];
+        for (uint8_t hold = 0; hold < 32; hold++) {
+            hold_tails(rank, hold, tails[hold]);
+        }
+        uint32_t kept = HOLD_FROM[rank];
+        for (int8_t b = 31; b >= 0; b--) {
+            uint32_t draws_b = HOLD_DRAWS[__builtin_popcount(b)];
+            int dominated = 0;
+            for (int8_t a = 31; a > b && !dominated; a--) {
+                uint32_t draws_a = HOLD_DRAWS[__builtin_popcount(a)];
+                dominated = 1;
+                for (uint8_t combi = OnePr; combi <= Royal; combi++) {
+                    if ((uint64_t) tails[a][combi] * draws_b < (uint64_t) tails[b][combi] * draws_a) {
+                        dominated = 0;
+                        break;
+                    }
+                }
+            }
+            if (!dominated) {
+                for (uint8_t combi = 0; combi <= Royal; combi++) {
+                    WEIGHTED[combi][kept] = HOLD_COUNTS[rank][b][combi] * (HOLD_DRAWS_LCM / draws_b);
+                }
+                kept++;
+            }
+        }
+        HOLD_FROM[rank + 1] = kept;
+    }
+}
+
+// candidate i in mixed radix of the ranges, HighC the lowest digit; 0 when the prizes decrease
+static int candidate(uint64_t i, uint32_t prizes[10]) {
+    for (uint8_t combi = 0; combi <= Royal; combi++) {
+        uint64_t radix = HI[combi] - LO[combi] + 1;
+        prizes[combi] = LO[combi] + i % radix;
+        i /= radix;
+        if (combi > HighC && prizes[combi] < prizes[combi - 1]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// the prize totals of all kept holds under a table, exact in doubles: at most 3960 x 10^6 per combi
+typedef struct {
+    uint32_t prizes[10];
+    double *totals;
+} totals_t;
+
+// moves the totals from their table to prizes, a pass over the holds for every prize that differs:
+// next candidates mostly differ in the lowest digit
+static void update_totals(totals_t *t, const uint32_t prizes[10]) {
+    uint32_t kept = HOLD_FROM[HAND_COUNT];
+    for (uint8_t combi = HighC; combi <= Royal; combi++) {
+        if (prizes[combi] != t->prizes[combi]) {
+            double change = (double) prizes[combi] - t->prizes[combi];
+            const uint16_t *weighted = WEIGHTED[combi];
+            double *totals = t->totals;
+            for (uint32_t j = 0; j < kept; j++) {
+                totals[j] += weighted[j] * change;
+            }
+            t->prizes[combi] = prizes[combi];
+        }
+    }
+}
+
+static void evaluate(totals_t *t, const uint32_t prizes[10], result_t *r) {
+    update_totals(t, prizes);
+    const double *totals = t->totals;
+    double returned = 0;
+    double squares = 0;
+    double hits = 0;
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t best = HOLD_FROM[rank];
+        for (uint32_t j = best + 1; j < HOLD_FROM[rank + 1]; j++) {
+            if (totals[j] > totals[best]) {
+                best = j;
+            }
+        }
+        returned += totals[best];
+        for (uint8_t combi = HighC; combi <= Royal; combi++) {
+            if (prizes[combi]) {
+                squares += (double) WEIGHTED[combi][best] * prizes[combi] * prizes[combi];
+                hits += WEIGHTED[combi][best];
+            }
+        }
+    }
+    double den = (double) HAND_COUNT * HOLD_DRAWS_LCM;
+    memcpy(r->prizes, prizes, sizeof(r->prizes));
+    r->returned = returned / den;
+    r->stddev = sqrt(squares / den - r->returned * r->returned);
+    r->hit_rate = hits / den;
+}
+
+// closer to the target first, then the lower stddev
+static int result_before(const result_t *a, const result_t *b) {
+    double da = fabs(a->returned - target);
+    double db = fabs(b->returned - target);
+    return da < db || (da == db && a->stddev < b->stddev);
+}
+
+static void keep_result(search_thread_t *t, const result_t *r) {
+    int i = t->result_count;
+    if (i == result_max) {
+        if (!result_before(r, &t->results[i - 1])) {
+            return;
+        }
+        i--;
+    } else {
+        t->result_count++;
+    }
+    for (; i > 0 && result_before(r, &t->results[i - 1]); i--) {
+        t->results[i] = t->results[i - 1];
+    }
+    t->results[i] = *r;
+}
+
+static void *search_run(void *arg) {
+    search_thread_t *t = arg;
+    uint64_t i;
+    uint32_t prizes[10];
+    result_t r;
+    // all prizes 0
+    totals_t totals = {.totals = calloc(HOLD_FROM[HAND_COUNT], sizeof(double))};
+    while (ranges_take(&work, t - threads, &i)) {
+        if (!candidate(i, prizes)) {
+            continue;
+        }
+        evaluate(&totals, prizes, &r);
+        t->evaluated++;
+        if (fabs(r.returned - target) <= tolerance && r.stddev >= stddev_lo && r.stddev <= stddev_hi) {
+            t->matched++;
+            keep_result(t, &r);
+        }
+    }
+    free(totals.totals);
+    return NULL;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: search_paytable [-t threads] [-j royal] [-r return] [-d tolerance] [-v stddev_lo:stddev_hi] [-n count] [ranges]\n");
+    fprintf(stderr, "  ranges   10 prizes or lo:hi as PAYOUTS_PRIZES, default 0,0,0,0:2,0:4,1:6,1:8,2:15,10:40,250\n");
+    exit(2);
+}
+
+// 10 entries separated by commas or spaces, each a prize or lo:hi
+static int parse_ranges(const char *text) {
+    char *end;
+    for (uint8_t combi = 0; combi <= Royal; combi++) {
+        while (*text == ',' || *text == ' ') {
+            text++;
+        }
+        LO[combi] = HI[combi] = strtoul(text, &end, 10);
+        if (end == text) {
+            return 0;
+        }
+        text = end;
+        if (*text == ':') {
+            HI[combi] = strtoul(++text, &end, 10);
+            if (end == text || HI[combi] < LO[combi]) {
+                return 0;
+            }
+            text = end;
+        }
+    }
+    return *text == 0;
+}
+
+int main(int argc, char *argv[]) {
+    thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t royal = 0;
+    int opt;
+    parse_ranges("0,0,0,0:2,0:4,1:6,1:8,2:15,10:40,250");
+    while ((opt = getopt(argc, argv, "t:j:r:d:v:n:")) != -1) {
+        switch (opt) {
+            case 't':
+                thread_count = atoi(optarg);
+                break;
+            case 'j':
+                royal = strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                target = atof(optarg);
+                break;
+            case 'd':
+                tolerance = atof(optarg);
+                break;
+            case 'v':
+                if (sscanf(optarg, "%lf:%lf", &stddev_lo, &stddev_hi) != 2) {
+                    usage();
+                }
+                break;
+            case 'n':
+                result_max = atoi(optarg);
+                break;
+            default:
+                usage();
+        }
+    }
+    if (optind < argc && (argc - optind > 1 || !parse_ranges(argv[optind]))) {
+        usage();
+    }
+    if (thread_count < 1 || result_max < 1 || result_max > MAX_RESULTS) {
+        usage();
+    }
+    if (royal) {
+        LO[Royal] = HI[Royal] = royal;
+    }
+    // the totals of a hold, up to 792 redraws of the prize, times the draws of another fit in 64 bits
+    uint64_t candidates = 1;
+    for (uint8_t combi = 0; combi <= Royal; combi++) {
+        if (HI[combi] > 1000000 || candidates > UINT64_MAX / (HI[combi] - LO[combi] + 1)) {
+            usage();
+        }
+        candidates *= HI[combi] - LO[combi] + 1;
+    }
+
+    double t = now();
+    subsets_init();
+    prune_holds();
+    uint32_t kept = HOLD_FROM[HAND_COUNT];
+    double init_time = now() - t;
+
+    threads = calloc(thread_count, sizeof(search_thread_t));
+    ranges_init(&work, thread_count, candidates);
+    t = now();
+    for (int i = 0; i < thread_count; i++) {
+        pthread_create(&threads[i].thread, NULL, search_run, &threads[i]);
+    }
+    for (int i = 0; i < thread_count; i++) {
+        pthread_join(threads[i].thread, NULL);
+    }
+    double run_time = now() - t;
+    ranges_free(&work);
+
+    // merge the best of every thread
+    search_thread_t all = {0};
+    uint64_t evaluated = 0;
+    uint64_t matched = 0;
+    for (int i = 0; i < thread_count; i++) {
+        evaluated += threads[i].evaluated;
+        matched += threads[i].matched;
+        for (uint8_t j = 0; j < threads[i].result_count; j++) {
+            keep_result(&all, &threads[i].results[j]);
+        }
+    }
+    printf("candidates %llu evaluated %llu matched %llu threads %d\n", (unsigned long long) candidates, (unsigned long long) evaluated, (unsigned long long) matched, thread_count);
+    printf("init %.2fs holds %.1f of 32 run %.2fs %.0f tables/s\n", init_time, (double) kept / HAND_COUNT, run_time, evaluated / run_time);
+    for (uint8_t i = 0; i < all.result_count; i++) {
+        const result_t *r = &all.results[i];
+        printf("paytable");
+        for (uint8_t combi = 0; combi <= Royal; combi++) {
+            printf(" %u", r->prizes[combi]);
+        }
+        printf("  return %.9f stddev %.4f hit rate %.6f\n", r->returned, r->stddev, r->hit_rate);
+    }
+    free(threads);
+    return 0;
+}
@@ -0,0 +1,337 @@
+// gcc -O2 -Wall -pthread -I.. sim_rtp.c strategy.c sim_shard.c hand_log.c -o sim_rtp -lm
+//
+// ./sim_rtp [-s strategy] [-r rounds] [-t threads] [-S seed] [-h hands] [-k shard/shards] [-c checkpoint] [-i seconds] [-l hand_log]
+//
+// Monte Carlo return to player: plays the rounds of the face headless, one machine with its own jackpot,
+// counters and random stream per thread (stream i of the seed for thread i):
+// DEAL (1 coin in, jackpot++, deal 5 of 17), SELECT (the strategy picks the cards to hold),
+// REDRAW (the discards are not shuffled back), SETTLE (PAYOUTS_PRIZES, Royal pays and resets the jackpot).
+// With -h the rounds are multi hand deals as in the face: hands coins in, the extra hands take the held cards
+// and redraw with play_hands. RTP and the combi frequencies are per hand, the stddev per coin of a round.
+// With -k the run is shard shard (from 0) of shards of a campaign of -r rounds, on streams of its own, see
+// sim_shard.h. With -c it writes its state to the checkpoint file every -i seconds (default 60) and on
+// SIGINT or SIGTERM, and at the end; run again with the same options it resumes from the file, and
+// merge_sim adds up the files of the shards.
+// -l writes every round to the hand log hand_log (hand_log.h), hand_log.i for thread i with more threads; the
+// balance there is the net win of the thread from 0 (two's complement). Not with -c, a resumed run would log
+// the rounds after the last checkpoint twice.
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bird_poker_hands.h"
+#include "bird_poker_score_table.h"
+#include "strategy.h"
+#include "sim_shard.h"
+#include "hand_log.h"
+
+// rounds between the publications of a thread's state, for the checkpoints and to stop on a signal
+#define SIM_CHUNK (1 << 16)
+
+typedef struct {
+    pthread_t thread;
+    sim_state_t state; // as of its last chunk, under lock
+    uint8_t hands;
+    const strategy_t *strategy;
+    hand_log_t *log; // NULL without -l
+} sim_thread_t;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t finished_cond = PTHREAD_COND_INITIALIZER;
+static int finished;
+static volatile sig_atomic_t stopping;
+
+static void stop(int signal) {
+    (void) signal;
+    stopping = 1;
+}
+
+static void *sim_run(void *arg) {
+    sim_thread_t *t = arg;
+    hold_strategy_t hold = t->strategy->hold;
+    pthread_mutex_lock(&lock);
+    sim_state_t s = t->state;
+    pthread_mutex_unlock(&lock);
+    bird_poker_rng_t rng = s.rng;
+    uint8_t *deck = s.deck;
+    uint64_t jackpot = s.jackpot;
+    sim_counts_t counts = s.counts;
+    uint64_t balance = 0;
+
+    while (counts.rounds < s.rounds && !stopping) {
+        uint64_t chunk = s.rounds - counts.rounds < SIM_CHUNK ? s.rounds - counts.rounds : SIM_CHUNK;
+        for (uint64_t round = 0; round < chunk; round++) {
+            jackpot += t->hands;
+            // deal: partial Fisher-Yates, the hand is deck[0..4]
+            uint32_t hand = 0;
+            for (int i = 0; i < 5; i++) {
+                int j = i + bird_poker_rng_below(&rng, 17 - i);
+                uint8_t c = deck[j];
+                deck[j] = deck[i];
+                deck[i] = c;
+                hand |= 1 << c;
+            }
+            uint32_t held = hold(hand, jackpot);
+            // redraw from deck[5..16]
+            uint32_t final = held;
+            int next = 5;
+            for (int i = 5 - __builtin_popcount(held); i > 0; i--) {
+                int j = next + bird_poker_rng_below(&rng, 17 - next);
+                uint8_t c = deck[j];
+                deck[j] = deck[next];
+                deck[next] = c;
+                final |= 1 << c;
+                next++;
+            }
+            uint8_t combi = MASK_COMBIS[final >> 1];
+            uint64_t prize = PAYOUTS_PRIZES[combi];
+            if (t->hands == 1) {
+                if (combi == Royal) {
+                    prize = jackpot;
+                    counts.jackpot_hits++;
+                    counts.jackpot_paid += jackpot;
+                    jackpot = PAYOUTS_PRIZES[Royal];
+                }
+                counts.combi_hits[combi]++;
+            } else {
+                uint8_t combi_counts[10] = {0};
+                combi_counts[combi]++;
+                play_hands(&rng, hand, held, t->hands - 1, combi_counts);
+                prize = 0;
+                for (combi = HighC; combi < Royal; combi++) {
+                    prize += combi_counts[combi] * PAYOUTS_PRIZES[combi];
+                    counts.combi_hits[combi] += combi_counts[combi];
+                }
+                // as the face: the first Royal takes the jackpot, more Royals the jackpot it resets to
+                if (combi_counts[Royal]) {
+                    prize += jackpot + (combi_counts[Royal] - 1) * PAYOUTS_PRIZES[Royal];
+                    counts.jackpot_hits++;
+                    counts.jackpot_paid += jackpot;
+                    jackpot = PAYOUTS_PRIZES[Royal];
+                    counts.combi_hits[Royal] += combi_counts[Royal];
+                }
+            }
+            counts.paid += prize;
+            counts.paid_squares += prize * prize;
+            if (t->log) {
+                balance += prize - t->hands;
+                bird_poker_round_t logged = {hand_rank(hand), hold_bits(hand, held), log_redraw_rank(hand, final & ~held),
+                                             t->hands, SCORE_TABLE[hand_rank(final)], prize, balance, jackpot};
+                hand_log_write(t->log, &logged);
+            }
+        }
+        counts.rounds += chunk;
+
+        pthread_mutex_lock(&lock);
+        t->state.rng = rng;
+        memcpy(t->state.deck, deck, 17);
+        t->state.jackpot = jackpot;
+        t->state.counts = counts;
+        pthread_mutex_unlock(&lock);
+    }
+
+    pthread_mutex_lock(&lock);
+    finished++;
+    pthread_cond_signal(&finished_cond);
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+// writes the states of the threads as of their last chunk
+static void checkpoint(const char *path, const sim_shard_t *shard, sim_thread_t *ts) {
+    sim_state_t *states = malloc(shard->threads * sizeof(sim_state_t));
+    pthread_mutex_lock(&lock);
+    for (uint32_t i = 0; i < shard->threads; i++) {
+        states[i] = ts[i].state;
+    }
+    pthread_mutex_unlock(&lock);
+    if (!sim_shard_write(path, shard, states)) {
+        perror(path);
+    }
+    free(states);
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: sim_rtp [-s strategy] [-r rounds] [-t threads] [-S seed] [-h hands] [-k shard/shards] [-c checkpoint] [-i seconds] [-l hand_log]\n");
+    for (uint8_t i = 0; i < STRATEGIES_LENGTH; i++) {
+        fprintf(stderr, "  -s %-10s %s\n", STRATEGIES[i].name, STRATEGIES[i].help);
+    }
+    exit(2);
+}
+
+int main(int argc, char *argv[]) {
+    const strategy_t *strategy = strategy_find("optimal");
+    uint64_t rounds = 100000000;
+    int threads = sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t seed = 1;
+    int hands = 1;
+    uint32_t shard_i = 0;
+    uint32_t shards = 1;
+    const char *path = NULL;
+    int interval = 60;
+    const char *log_path = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "s:r:t:S:h:k:c:i:l:")) != -1) {
+        switch (opt) {
+            case 's':
+                strategy = strategy_find(optarg);
+                if (!strategy) {
+                    usage();
+                }
+                break;
+            case 'r':
+                rounds = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                threads = atoi(optarg);
+                break;
+            case 'S':
+                seed = strtoull(optarg, NULL, 10);
+                break;
+            case 'h':
+                hands = atoi(optarg);
+                break;
+            case 'k':
+                if (sscanf(optarg, "%u/%u", &shard_i, &shards) != 2) {
+                    usage();
+                }
+                break;
+            case 'c':
+                path = optarg;
+                break;
+            case 'i':
+                interval = atoi(optarg);
+                break;
+            case 'l':
+                log_path = optarg;
+                break;
+            default:
+                usage();
+        }
+    }
+    if (threads < 1 || threads > SIM_SHARD_MAX_THREADS || rounds < 1 || hands < 1 || hands > MAX_HANDS ||
+        shards < 1 || shard_i >= shards || strlen(strategy->name) > 15 || interval < 1 ||
+        (log_path && path)) {
+        usage();
+    }
+
+    sim_shard_t shard = {.seed = seed, .rounds = rounds, .hands = hands, .shard = shard_i, .shards = shards, .threads = threads};
+    strcpy(shard.strategy, strategy->name);
+    sim_state_t *states = NULL;
+    if (path && access(path, F_OK) == 0) {
+        // resume, on the threads of the checkpoint
+        sim_shard_t saved;
+        if (!sim_shard_read(path, &saved, &states)) {
+            return 1;
+        }
+        if (strcmp(saved.strategy, shard.strategy) || saved.seed != seed || saved.rounds != rounds ||
+            saved.hands != shard.hands || saved.shard != shard_i || saved.shards != shards) {
+            fprintf(stderr, "%s: strategy %s seed %llu rounds %llu hands %u shard %u/%u, not the run asked for\n", path,
+                    saved.strategy, (unsigned long long) saved.seed, (unsigned long long) saved.rounds, saved.hands,
+                    saved.shard, saved.shards);
+            return 1;
+        }
+        shard.threads = threads = saved.threads;
+    } else {
+        uint64_t shard_rounds = sim_shard_rounds(rounds, shard_i, shards);
+        states = calloc(threads, sizeof(sim_state_t));
+        for (int i = 0; i < threads; i++) {
+            states[i].rounds = shard_rounds / threads + ((uint64_t) i < shard_rounds % threads);
+            bird_poker_rng_seed(&states[i].rng, seed, sim_stream(&shard, i));
+            for (int c = 0; c < 17; c++) {
+                states[i].deck[c] = CA + c;
+            }
+            states[i].jackpot = PAYOUTS_PRIZES[Royal];
+        }
+    }
+    uint64_t played_before = 0;
+    for (int i = 0; i < threads; i++) {
+        played_before += states[i].counts.rounds;
+    }
+
+    double t = now();
+    if (strategy->init) {
+        strategy->init();
+    }
+    double init_time = now() - t;
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+    sim_thread_t *ts = calloc(threads, sizeof(sim_thread_t));
+    t = now();
+    for (int i = 0; i < threads; i++) {
+        ts[i].state = states[i];
+        ts[i].hands = hands;
+        ts[i].strategy = strategy;
+        if (log_path) {
+            char name[4096];
+            snprintf(name, sizeof(name), threads == 1 ? "%s" : "%s.%d", log_path, i);
+            ts[i].log = hand_log_create(name);
+            if (!ts[i].log) {
+                perror(name);
+                return 1;
+            }
+        }
+        pthread_create(&ts[i].thread, NULL, sim_run, &ts[i]);
+    }
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += interval;
+    pthread_mutex_lock(&lock);
+    while (finished < threads) {
+        if (pthread_cond_timedwait(&finished_cond, &lock, &deadline) == ETIMEDOUT) {
+            if (path) {
+                pthread_mutex_unlock(&lock);
+                checkpoint(path, &shard, ts);
+                pthread_mutex_lock(&lock);
+            }
+            deadline.tv_sec += interval;
+        }
+    }
+    pthread_mutex_unlock(&lock);
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ts[i].thread, NULL);
+        if (ts[i].log && !hand_log_close(ts[i].log)) {
+            perror(log_path);
+        }
+    }
+    double run_time = now() - t;
+    if (path) {
+        checkpoint(path, &shard, ts);
+    }
+
+    sim_counts_t totals = {0};
+    uint64_t shard_rounds = 0;
+    for (int i = 0; i < threads; i++) {
+        sim_counts_add(&totals, &ts[i].state.counts);
+        shard_rounds += ts[i].state.rounds;
+    }
+    free(ts);
+    free(states);
+
+    double played = totals.rounds - played_before;
+    printf("strategy %s rounds %llu hands %d threads %d seed %llu", strategy->name, (unsigned long long) totals.rounds, hands, threads, (unsigned long long) seed);
+    if (shards > 1) {
+        printf(" shard %u/%u of %llu rounds", shard_i, shards, (unsigned long long) rounds);
+    }
+    printf("\n");
+    printf("init %.2fs run %.2fs %.1f Mrounds/s %.1f Mhands/s\n", init_time, run_time, played / run_time / 1e6, played * hands / run_time / 1e6);
+    if (totals.rounds < shard_rounds) {
+        printf("stopped after %llu of %llu rounds%s\n", (unsigned long long) totals.rounds, (unsigned long long) shard_rounds,
+               path ? ", the same options resume from the checkpoint" : "");
+    }
+    if (totals.rounds) {
+        sim_report(&totals, hands);
+    }
+    return totals.rounds < shard_rounds;
+}
@@ -0,0 +1,177 @@
+// Shard files of sim_rtp, see sim_shard.h
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "sim_shard.h"
+#include "bird_poker_score.h"
+
+static const char MAGIC[8] = {'B', 'P', 'S', 'I', 'M', 'S', 'H', 'D'};
+
+#define HEADER_BYTES (8 + 4 + 16 + 8 + 8 + 4 * 4)
+#define THREAD_BYTES (4 * 8 + 17 + 14 * 8)
+
+typedef struct {
+    uint8_t *bytes;
+    size_t at;
+} cursor_t;
+
+static void put(cursor_t *c, uint64_t x, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++) {
+        c->bytes[c->at++] = x >> (8 * i);
+    }
+}
+
+static uint64_t get(cursor_t *c, uint8_t n) {
+    uint64_t x = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        x |= (uint64_t) c->bytes[c->at++] << (8 * i);
+    }
+    return x;
+}
+
+static uint64_t fnv1a(const uint8_t *bytes, size_t n) {
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < n; i++) {
+        h = (h ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return h;
+}
+
+int sim_shard_write(const char *path, const sim_shard_t *shard, const sim_state_t *states) {
+    size_t n = HEADER_BYTES + shard->threads * THREAD_BYTES;
+    cursor_t c = {malloc(n + 8), 0};
+    memcpy(c.bytes, MAGIC, 8);
+    c.at = 8;
+    put(&c, SIM_SHARD_VERSION, 4);
+    memcpy(c.bytes + c.at, shard->strategy, 16);
+    c.at += 16;
+    put(&c, shard->seed, 8);
+    put(&c, shard->rounds, 8);
+    put(&c, shard->hands, 4);
+    put(&c, shard->shard, 4);
+    put(&c, shard->shards, 4);
+    put(&c, shard->threads, 4);
+    for (uint32_t t = 0; t < shard->threads; t++) {
+        const sim_state_t *s = &states[t];
+        put(&c, s->rounds, 8);
+        put(&c, s->counts.rounds, 8);
+        put(&c, s->rng.position, 8);
+        put(&c, s->jackpot, 8);
+        memcpy(c.bytes + c.at, s->deck, 17);
+        c.at += 17;
+        put(&c, s->counts.paid, 8);
+        put(&c, s->counts.paid_squares, 8);
+        put(&c, s->counts.jackpot_hits, 8);
+        put(&c, s->counts.jackpot_paid, 8);
+        for (uint8_t combi = 0; combi < 10; combi++) {
+            put(&c, s->counts.combi_hits[combi], 8);
+        }
+    }
+    put(&c, fnv1a(c.bytes, n), 8);
+
+    char tmp[4096];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE *f = fopen(tmp, "wb");
+    int ok = f && fwrite(c.bytes, n + 8, 1, f) == 1 && fflush(f) == 0 && fsync(fileno(f)) == 0;
+    if (f && fclose(f) != 0) {
+        ok = 0;
+    }
+    ok = ok && rename(tmp, path) == 0;
+    free(c.bytes);
+    return ok;
+}
+
+int sim_shard_read(const char *path, sim_shard_t *shard, sim_state_t **states) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+    uint8_t header[HEADER_BYTES];
+    cursor_t c = {header, 8};
+    if (fread(header, HEADER_BYTES, 1, f) != 1 || memcmp(header, MAGIC, 8) != 0) {
+        fprintf(stderr, "%s: not a shard file\n", path);
+        fclose(f);
+        return 0;
+    }
+    uint32_t version = get(&c, 4);
+    if (version != SIM_SHARD_VERSION) {
+        fprintf(stderr, "%s: version %u, not %u\n", path, version, SIM_SHARD_VERSION);
+        fclose(f);
+        return 0;
+    }
+    memcpy(shard->strategy, header + c.at, 16);
+    shard->strategy[15] = 0;
+    c.at += 16;
+    shard->seed = get(&c, 8);
+    shard->rounds = get(&c, 8);
+    shard->hands = get(&c, 4);
+    shard->shard = get(&c, 4);
+    shard->shards = get(&c, 4);
+    shard->threads = get(&c, 4);
+    if (shard->threads < 1 || shard->threads > SIM_SHARD_MAX_THREADS || shard->shard >= shard->shards) {
+        fprintf(stderr, "%s: damaged\n", path);
+        fclose(f);
+        return 0;
+    }
+    size_t n = HEADER_BYTES + shard->threads * THREAD_BYTES;
+    c.bytes = malloc(n + 8);
+    memcpy(c.bytes, header, HEADER_BYTES);
+    int ok = fread(c.bytes + HEADER_BYTES, n + 8 - HEADER_BYTES, 1, f) == 1;
+    fclose(f);
+    c.at = n;
+    if (!ok || get(&c, 8) != fnv1a(c.bytes, n)) {
+        fprintf(stderr, "%s: damaged\n", path);
+        free(c.bytes);
+        return 0;
+    }
+    c.at = HEADER_BYTES;
+    *states = calloc(shard->threads, sizeof(sim_state_t));
+    for (uint32_t t = 0; t < shard->threads; t++) {
+        sim_state_t *s = &(*states)[t];
+        s->rounds = get(&c, 8);
+        s->counts.rounds = get(&c, 8);
+        bird_poker_rng_seed(&s->rng, shard->seed, sim_stream(shard, t));
+        bird_poker_rng_skip(&s->rng, get(&c, 8));
+        s->jackpot = get(&c, 8);
+        memcpy(s->deck, c.bytes + c.at, 17);
+        c.at += 17;
+        s->counts.paid = get(&c, 8);
+        s->counts.paid_squares = get(&c, 8);
+        s->counts.jackpot_hits = get(&c, 8);
+        s->counts.jackpot_paid = get(&c, 8);
+        for (uint8_t combi = 0; combi < 10; combi++) {
+            s->counts.combi_hits[combi] = get(&c, 8);
+        }
+    }
+    free(c.bytes);
+    return 1;
+}
+
+void sim_counts_add(sim_counts_t *a, const sim_counts_t *b) {
+    a->rounds += b->rounds;
+    a->paid += b->paid;
+    a->paid_squares += b->paid_squares;
+    a->jackpot_hits += b->jackpot_hits;
+    a->jackpot_paid += b->jackpot_paid;
+    for (uint8_t combi = 0; combi < 10; combi++) {
+        a->combi_hits[combi] += b->combi_hits[combi];
+    }
+}
+
+void sim_report(const sim_counts_t *totals, uint32_t hands) {
+    double rounds_n = totals->rounds;
+    double n = rounds_n * hands;
+    double rtp = totals->paid / n;
+    double variance = totals->paid_squares / rounds_n / hands / hands - rtp * rtp;
+    printf("RTP %.6f +- %.6f (95%%) stddev %.4f\n", rtp, 1.96 * sqrt(variance / rounds_n), sqrt(variance));
+    printf("jackpot hits %llu mean jackpot %.1f\n", (unsigned long long) totals->jackpot_hits,
+           totals->jackpot_hits ? (double) totals->jackpot_paid / totals->jackpot_hits : 0);
+    printf("combi %12s %10s %10s\n", "hits", "freq", "+- 95%");
+    for (int combi = Royal; combi >= HighC; combi--) {
+        double p = totals->combi_hits[combi] / n;
+        printf("%-5s %12llu %10.6f %10.6f\n", PAYOUTS_NAMES[combi], (unsigned long long) totals->combi_hits[combi], p, 1.96 * sqrt(p * (1 - p) / n));
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef bird_poker_SIM_SHARD_H_
+#define bird_poker_SIM_SHARD_H_
+
+// Shard files of sim_rtp: the checkpoint of a run, and its result once all rounds are played.
+// A campaign of -r rounds with -k shard/shards splits into shards runs, each with its share of the rounds and
+// its threads on streams shard + shards * thread of the seed, so no two threads of the campaign share a
+// stream. merge_sim adds the counts of any set of shard files of the same campaign, exactly.
+//
+// Version 1, integers little endian:
+// "BPSIMSHD"  8 bytes
+// version     u32
+// strategy    16 bytes, the name 0 padded
+// seed        u64
+// rounds      u64, of the whole campaign
+// hands       u32
+// shard       u32
+// shards      u32
+// threads     u32
+// then per thread: rounds u64 (its share), played u64, rng position u64, jackpot u64, deck 17 bytes,
+//                  paid u64, paid_squares u64, jackpot_hits u64, jackpot_paid u64, combi_hits 10 x u64
+// FNV-1a 64 of all the bytes before it, u64
+
+#include <stdint.h>
+#include "bird_poker_rng.h"
+
+#define SIM_SHARD_VERSION 1
+#define SIM_SHARD_MAX_THREADS 1024
+
+typedef struct {
+    uint64_t rounds;
+    uint64_t paid;
+    uint64_t paid_squares;
+    uint64_t jackpot_hits; // rounds the jackpot was paid out
+    uint64_t jackpot_paid;
+    uint64_t combi_hits[10];
+} sim_counts_t;
+
+// where a thread is: its rounds played so far are counts.rounds, the deck order carries over to the next round
+typedef struct {
+    uint64_t rounds; // its share of the rounds
+    bird_poker_rng_t rng;
+    uint64_t jackpot;
+    uint8_t deck[17];
+    sim_counts_t counts;
+} sim_state_t;
+
+typedef struct {
+    char strategy[16];
+    uint64_t seed;
+    uint64_t rounds;
+    uint32_t hands;
+    uint32_t shard;
+    uint32_t shards;
+    uint32_t threads;
+} sim_shard_t;
+
+// the stream of thread of the shard
+static inline uint32_t sim_stream(const sim_shard_t *shard, uint32_t thread) {
+    return shard->shard + shard->shards * thread;
+}
+
+// the rounds of shard shard of a campaign of rounds rounds
+static inline uint64_t sim_shard_rounds(uint64_t rounds, uint32_t shard, uint32_t shards) {
+    return rounds / shards + (shard < rounds % shards);
+}
+
+// writes path through path.tmp, so a kill leaves the last whole checkpoint; 0 and errno on failure
+int sim_shard_write(const char *path, const sim_shard_t *shard, const sim_state_t *states);
+
+// reads path into shard and *states (malloc'd, shard->threads of them); 0 with a message on stderr when it is
+// missing, damaged or of another version
+int sim_shard_read(const char *path, sim_shard_t *shard, sim_state_t **states);
+
+// adds b to a
+void sim_counts_add(sim_counts_t *a, const sim_counts_t *b);
+
+// RTP with its 95% interval and stddev, jackpot hits, and the combi frequencies
+void sim_report(const sim_counts_t *totals, uint32_t hands);
+
+#endif // bird_poker_SIM_SHARD_H_
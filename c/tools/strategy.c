@@ -0,0 +1,137 @@
+// Hold strategies, see strategy.h
+#include <string.h>
+#include "strategy.h"
+#include "bird_poker_score_table.h"
+#include "bird_poker_hold_table.h"
+
+#define ALL_CARDS RANKS_UPTO(WK)
+#define WILD_CARDS (ALL_CARDS & ~RANKS_UPTO(CK))
+
+uint8_t MASK_COMBIS[1 << 17];
+
+__attribute__((constructor))
+static void strategy_init_combis(void) {
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        MASK_COMBIS[hand_unrank(rank) >> 1] = SCORE_TABLE[rank] >> 4;
+    }
+}
+
+uint64_t hold_total(uint32_t hand, uint32_t held, uint64_t royal_prize, uint32_t *draws) {
+    // spread a 12 bit draw over the cards left in the deck, 8 + 4 bits at a time
+    uint32_t deck = ALL_CARDS & ~hand;
+    uint32_t spread_lo[256];
+    uint32_t spread_hi[16];
+    uint32_t cards[12];
+    for (int i = 0; i < 12; i++) {
+        cards[i] = deck & -deck;
+        deck &= deck - 1;
+    }
+    for (int x = 0; x < 256; x++) {
+        spread_lo[x] = 0;
+        for (int i = 0; i < 8; i++) {
+            if (x & (1 << i)) {
+                spread_lo[x] |= cards[i];
+            }
+        }
+    }
+    for (int x = 0; x < 16; x++) {
+        spread_hi[x] = 0;
+        for (int i = 0; i < 4; i++) {
+            if (x & (1 << i)) {
+                spread_hi[x] |= cards[8 + i];
+            }
+        }
+    }
+
+    uint32_t combi_counts[10] = {0};
+    uint32_t count = 0;
+    int k = 5 - __builtin_popcount(held);
+    // all k of 12 bit subsets in increasing order (Gosper's hack)
+    for (uint32_t x = (1 << k) - 1; x < (1 << 12); ) {
+        combi_counts[MASK_COMBIS[(held | spread_lo[x & 0xFF] | spread_hi[x >> 8]) >> 1]]++;
+        count++;
+        if (x == 0) {
+            break;
+        }
+        uint32_t low = x & -x;
+        uint32_t ripple = x + low;
+        x = (((ripple ^ x) >> 2) / low) | ripple;
+    }
+    uint64_t total = combi_counts[Royal] * royal_prize;
+    for (int combi = HighC; combi < Royal; combi++) {
+        total += (uint64_t) combi_counts[combi] * PAYOUTS_PRIZES[combi];
+    }
+    *draws = count;
+    return total;
+}
+
+static uint32_t hold_nothing(uint32_t hand, uint64_t jackpot) {
+    (void) hand;
+    (void) jackpot;
+    return 0;
+}
+
+// keep a paying hand, else keep the wildcards
+static uint32_t hold_heuristic(uint32_t hand, uint64_t jackpot) {
+    (void) jackpot;
+    if (PAYOUTS_PRIZES[score_lookup(hand) >> 4]) {
+        return hand;
+    }
+    return hand & WILD_CARDS;
+}
+
+uint32_t hold_best(uint32_t hand, uint64_t royal_prize) {
+    uint64_t best_total = 0;
+    uint32_t best_draws = 1;
+    uint32_t best_held = hand;
+    // subsets of the hand, from holding all down to holding nothing, first best wins
+    for (uint32_t held = hand; ; held = (held - 1) & hand) {
+        uint32_t draws;
+        uint64_t total = hold_total(hand, held, royal_prize, &draws);
+        if (total * best_draws > best_total * draws) {
+            best_total = total;
+            best_draws = draws;
+            best_held = held;
+        }
+        if (held == 0) {
+            break;
+        }
+    }
+    return best_held;
+}
+
+// best hold by hand rank, for the starting jackpot
+static uint32_t OPTIMAL_HOLDS[HAND_COUNT];
+
+static void optimal_init(void) {
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        OPTIMAL_HOLDS[rank] = hold_best(hand_unrank(rank), PAYOUTS_PRIZES[Royal]);
+    }
+}
+
+static uint32_t hold_optimal(uint32_t hand, uint64_t jackpot) {
+    (void) jackpot;
+    return OPTIMAL_HOLDS[hand_rank(hand)];
+}
+
+// the tables of the face, from the starting jackpot on
+static uint32_t hold_aware(uint32_t hand, uint64_t jackpot) {
+    return hold_lookup_jackpot_cards(hand, jackpot);
+}
+
+const strategy_t STRATEGIES[] = {
+    {"nothing", "redraw all 5 cards", NULL, hold_nothing},
+    {"heuristic", "hold a paying hand, else hold the wildcards", NULL, hold_heuristic},
+    {"optimal", "hold with the best expected prize, Royal paying the starting jackpot", optimal_init, hold_optimal},
+    {"aware", "hold with the best expected prize, Royal paying the jackpot", NULL, hold_aware},
+};
+const uint8_t STRATEGIES_LENGTH = sizeof(STRATEGIES) / sizeof(STRATEGIES[0]);
+
+const strategy_t *strategy_find(const char *name) {
+    for (uint8_t i = 0; i < STRATEGIES_LENGTH; i++) {
+        if (strcmp(STRATEGIES[i].name, name) == 0) {
+            return &STRATEGIES[i];
+        }
+    }
+    return NULL;
+}
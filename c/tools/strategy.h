@@ -0,0 +1,36 @@
+#ifndef bird_poker_STRATEGY_H_
+#define bird_poker_STRATEGY_H_
+
+// Hold strategies for the host simulators.
+// A strategy gets the dealt hand as a 17 bit card mask and the current jackpot,
+// and returns the mask of the cards to hold, the other cards are redrawn.
+
+#include <stdint.h>
+
+typedef uint32_t (*hold_strategy_t)(uint32_t hand, uint64_t jackpot);
+
+typedef struct {
+    const char *name;
+    const char *help;
+    void (*init)(void); // NULL or one-time setup, call before hold from any thread
+    hold_strategy_t hold;
+} strategy_t;
+
+// combi by card mask >> 1, filled at startup
+extern uint8_t MASK_COMBIS[1 << 17];
+
+extern const strategy_t STRATEGIES[];
+extern const uint8_t STRATEGIES_LENGTH;
+
+// NULL when there's no strategy with that name
+const strategy_t *strategy_find(const char *name);
+
+// sum of the prizes of all ways to redraw the cards of hand that are not held, with Royal paying royal_prize,
+// *draws gets the number of ways
+uint64_t hold_total(uint32_t hand, uint32_t held, uint64_t royal_prize, uint32_t *draws);
+
+// the held cards of hand with the best expected prize, with Royal paying royal_prize, of equal ones the first
+// of the subsets counted down from the whole hand
+uint32_t hold_best(uint32_t hand, uint64_t royal_prize);
+
+#endif // bird_poker_STRATEGY_H_
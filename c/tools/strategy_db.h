@@ -0,0 +1,28 @@
+#ifndef bird_poker_STRATEGY_DB_H_
+#define bird_poker_STRATEGY_DB_H_
+
+// The solved strategy and outcomes of a paytable as exact_rtp -o writes them, in host byte order:
+// a strategy_db_header_t, SUBSET_COMBIS of subsets.h, then a strategy_db_hand_t per dealt hand by hand_rank.
+// The redraws of the holds that aren't the best follow from the subset counts with subset_counts.
+
+#include <stdint.h>
+
+#define STRATEGY_DB_MAGIC "BIRDSTRT"
+#define STRATEGY_DB_VERSION 1
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint16_t subset_count; // SUBSET_COUNT
+    uint16_t hand_count; // HAND_COUNT
+    uint64_t prizes[10]; // the paytable, Royal the jackpot it pays
+} strategy_db_header_t;
+
+typedef struct {
+    uint64_t total; // the prizes of all redraws of the best hold, its expected prize is total / redraws
+    uint16_t combis[10]; // the redraws of the best hold by combi
+    uint8_t hold; // the best hold, bit i holds the i-th lowest card of the hand as HOLD_TABLE
+    uint8_t reserved[3];
+} strategy_db_hand_t;
+
+#endif // bird_poker_STRATEGY_DB_H_
@@ -0,0 +1,83 @@
+// Final hands by the cards they share, see subsets.h
+#include <stdlib.h>
+#include "subsets.h"
+#include "bird_poker_score_table.h"
+#include "bird_poker_hold_table.h"
+
+uint16_t SUBSET_COMBIS[SUBSET_COUNT][10];
+uint16_t HOLD_COUNTS[HAND_COUNT][32][10];
+
+// the first rank of the subsets with k cards
+static const uint16_t SUBSET_FROM[6] = {0, 1, 18, 154, 834, 3214};
+
+uint16_t subset_rank(uint32_t mask) {
+    uint8_t k = __builtin_popcount(mask);
+    uint16_t rank = SUBSET_FROM[k];
+    mask >>= 1;
+    for (uint8_t i = 1; i <= k; i++) {
+        rank += HAND_BINOM[__builtin_ctz(mask)][i];
+        mask &= mask - 1;
+    }
+    return rank;
+}
+
+void subsets_init(void) {
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t hand = hand_unrank(rank);
+        uint8_t combi = SCORE_TABLE[rank] >> 4;
+        // every subset of the hand, the empty one last
+        for (uint32_t x = hand; ; x = (x - 1) & hand) {
+            SUBSET_COMBIS[subset_rank(x)][combi]++;
+            if (x == 0) {
+                break;
+            }
+        }
+    }
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t hand = hand_unrank(rank);
+        for (uint8_t hold = 0; hold < 32; hold++) {
+            uint32_t counts[10];
+            subset_counts(hand, hold_cards(hand, hold), counts);
+            for (uint8_t combi = 0; combi < 10; combi++) {
+                HOLD_COUNTS[rank][hold][combi] = counts[combi];
+            }
+        }
+    }
+}
+
+void subset_counts(uint32_t hand, uint32_t held, uint32_t counts[10]) {
+    uint32_t discards = hand & ~held;
+    int32_t sums[10] = {0};
+    // the final hands with the held cards less the ones with some discards: + for an even number of them
+    for (uint32_t x = discards; ; x = (x - 1) & discards) {
+        const uint16_t *combis = SUBSET_COMBIS[subset_rank(held | x)];
+        int32_t sign = (__builtin_popcount(x) & 1) ? -1 : 1;
+        for (uint8_t combi = 0; combi < 10; combi++) {
+            sums[combi] += sign * combis[combi];
+        }
+        if (x == 0) {
+            break;
+        }
+    }
+    for (uint8_t combi = 0; combi < 10; combi++) {
+        counts[combi] = sums[combi];
+    }
+}
+
+int parse_paytable(const char *text, uint64_t royal, uint64_t prizes[10]) {
+    char *end;
+    for (uint8_t combi = 0; combi <= Royal; combi++) {
+        while (*text == ',' || *text == ' ') {
+            text++;
+        }
+        prizes[combi] = strtoull(text, &end, 10);
+        if (end == text) {
+            return 0;
+        }
+        text = end;
+    }
+    if (royal) {
+        prizes[Royal] = royal;
+    }
+    return 1;
+}
@@ -0,0 +1,40 @@
+#ifndef bird_poker_SUBSETS_H_
+#define bird_poker_SUBSETS_H_
+
+// Final hands by the cards they share, for the exact tools.
+// SUBSET_COMBIS[subset_rank(x)][combi] counts the 5 card hands that contain the cards x (at most 5) by combi.
+// The redraws of a hold are the final hands that contain the held cards and none of the discards, by
+// inclusion-exclusion over the discards: the 9402 subset counts stand in for enumerating the redraws of every
+// hold of every hand.
+
+#include <stdint.h>
+#include "bird_poker_score.h"
+
+// subsets of the 17 cards with 0 to 5 cards: 1 + 17 + 136 + 680 + 2380 + 6188
+#define SUBSET_COUNT 9402
+
+extern uint16_t SUBSET_COMBIS[SUBSET_COUNT][10];
+
+// HOLD_COUNTS[rank][hold][combi] counts the redraws of every hold of every dealt hand by combi,
+// hold bit i holds the i-th lowest card of the hand as HOLD_TABLE
+extern uint16_t HOLD_COUNTS[HAND_COUNT][32][10];
+
+// redraws of 5 - k cards from the 12 left for a hold of k cards
+static const uint16_t HOLD_DRAWS[6] = {792, 495, 220, 66, 12, 1};
+// the least common multiple of HOLD_DRAWS, a dealt hand weighs HOLD_DRAWS_LCM / HOLD_DRAWS[held]
+#define HOLD_DRAWS_LCM 3960
+
+// fills SUBSET_COMBIS and HOLD_COUNTS, call before using them or subset_counts
+void subsets_init(void);
+
+// 0 <= rank < SUBSET_COUNT of a card mask with at most 5 cards: by number of cards, then colexicographic
+uint16_t subset_rank(uint32_t mask);
+
+// counts[combi] gets the redraws of the cards of hand that are not held by combi
+void subset_counts(uint32_t hand, uint32_t held, uint32_t counts[10]);
+
+// prizes gets the 10 prizes of text separated by commas or spaces, as PAYOUTS_PRIZES, the Royal royal when
+// royal isn't 0; 0 when text isn't a paytable
+int parse_paytable(const char *text, uint64_t royal, uint64_t prizes[10]);
+
+#endif // bird_poker_SUBSETS_H_
@@ -1,233 +1,159 @@
-// gcc bird.c -o bird.so -shared
-#define CA 1
-#define C2 2
-#define C3 3
-#define C4 4
-#define C5 5
-#define C6 6
-#define C7 7
-#define C8 8
-#define C9 9
-#define CT 10
-#define CJ 11
-#define CQ 12
-#define CK 13
-#define W4 14
-#define W7 15
-#define WT 16
-#define WK 17
-// CAHigh only used in output, not in hnd, doesn't clash with W4
-#define CAHigh 14
+// gcc -O2 -Wall -shared -fPIC -pthread -I../c bird.c -o bird.so
+//
+// Native scoring for the picolisp tools (bird_c.l), on the scoring of the watch face (../c). Cards are 1 (CA)
+// to 17 (WK) as the DECK index of bird.l, a score is (combi << 4) | highc as score() returns it. The batch
+// entry points fill buffers of the caller, so a whole table takes one native call.
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "bird_poker_score.h"
+#include "bird_poker_score_table.h"
+#include "bird_poker_deal.h"
+#include "bird_poker_hold_table.h"
+#include "bird_poker_ranges.h"
 
-int is_wild(int);
-inline int is_wild(int c) {
-   return c >= W4;
-}
-
-int wildcard_rank(int);
-inline int wildcard_rank(int c) {
-   if (c == W4) {
-      return 4;
-   } else if (c == W7) {
-      return 7;
-   } else if (c == WT) {
-      return 10;
-   } else if (c == WK) {
-      return 13;
-   } else {
-      return c;
-   }
-}
-
-#define Royal 9
-#define FiveK 8
-#define StrFl 7
-#define FourK 6
-#define Strgt 5
-#define Flush 4
-#define Trips 3
-#define OnePr 2
-#define HighC 1
+#define SCORES 160 // (Royal << 4) | CAHigh is the largest score
 
-void handsort(int[]);
+// score by card mask >> 1 (bit 0 is unused), for the masks count_double_draw makes
+static uint8_t MASK_SCORES[1 << 17];
 
-void handsort(int hnd[]) {
-   int i = 0;
-   int j = 0;
-   int swap = 0;
-   for (i = 0; i < 4; i++) {
-      swap = 0; // card is never 0
-      for (j = 0; j < 4 - i; j++) {
-         if (hnd[j] > hnd[j+1]) {
-            swap = hnd[j+1];
-            hnd[j+1] = hnd[j];
-            hnd[j] = swap;
-         }
-      }
-      if (!swap) {
-         break;
-      }
-   }
+__attribute__((constructor))
+static void bird_init(void) {
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        MASK_SCORES[hand_unrank(rank) >> 1] = SCORE_TABLE[rank];
+    }
 }
 
-int highcard(int[], int);
-
-// hnd is sorted
-int highcard(int hnd[], int wildcard_count) {
-   if (hnd[0] == CA) {
-      return CAHigh;
-   } else {
-      int highc = hnd[4];
-      if (highc >= W4) {
-        highc = wildcard_rank(highc);
-        // check if the highest non-wildcard is better
-        if (hnd[4 - wildcard_count] > highc) {
-          highc = hnd[4 - wildcard_count];
+// the card mask of 5 cards, 0 when they aren't 5 different cards
+static uint32_t cards_mask(int h0, int h1, int h2, int h3, int h4) {
+    int cards[5] = {h0, h1, h2, h3, h4};
+    uint32_t mask = 0;
+    for (uint8_t i = 0; i < 5; i++) {
+        if (cards[i] < CA || cards[i] > WK || (mask & (1u << cards[i]))) {
+            return 0;
         }
-      }
-      return highc;
-   }
+        mask |= 1u << cards[i];
+    }
+    return mask;
 }
 
-int score(int, int, int, int, int);
-
-int score(int h0, int h1, int h2, int h3, int h4) {
-   int hnd[] = {h0, h1, h2, h3, h4};
-   handsort(hnd);
+// the score of one hand, 0 for a hand that isn't 5 different cards
+int score_hand(int h0, int h1, int h2, int h3, int h4) {
+    uint32_t mask = cards_mask(h0, h1, h2, h3, h4);
+    return mask ? score_lookup(mask) : 0;
+}
 
-   // find flush
-   int is_flush = 1; // assume true unless hnd has any wildcard
+// scores n hands of 5 cards each, hands[5 * i] to hands[5 * i + 4], into scores[i]; returns the number of
+// hands that aren't 5 different cards, scored 0
+int score_hands(const uint8_t *hands, int n, uint8_t *scores) {
+    int invalid = 0;
+    for (int i = 0; i < n; i++, hands += 5) {
+        uint32_t mask = cards_mask(hands[0], hands[1], hands[2], hands[3], hands[4]);
+        scores[i] = mask ? score_lookup(mask) : 0;
+        invalid += !mask;
+    }
+    return invalid;
+}
 
-   int lowest_wildcard = 0; // needed for run/Nkind detection
-   int second_lowest_wildcard = 0;
-   int wildcard_count = 0;
-   int i = 0;
-   for (i = 0; i < 5; i++) {
-      if (is_wild(hnd[i])) {
-        is_flush = 0;
-        lowest_wildcard = hnd[i];
-        if (i < 4) {
-         second_lowest_wildcard = hnd[i+1];
+// all HAND_COUNT deals into hands, 5 cards low to high each, deal i is the one of hand_rank i; returns HAND_COUNT
+int deals(uint8_t *hands) {
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t mask = hand_unrank(rank);
+        for (uint8_t i = 0; i < 5; i++, mask &= mask - 1) {
+            *hands++ = __builtin_ctz(mask);
         }
-        wildcard_count = 5 - i;
-        break;
-      }
-   }
+    }
+    return HAND_COUNT;
+}
 
-   // find 5,4,3 (of a kind), 2 (pair)
-   int run_length = 0;
-   int run_rank = 0;
-   if (lowest_wildcard) { // aka when not a flush
-    // can make at least wildcard_count of a kind with rank lowest_wildcard
-    // if there's a card lower or equal to lowest_wildcard there's a wildcard_count+1 of a kind
-    run_rank = wildcard_rank(lowest_wildcard);
-    for (i = 4 - wildcard_count; i >= 0; i--) { // high to low non-wildcards
-      if (hnd[i] <= run_rank) {
-         run_rank = hnd[i];
-         run_length = wildcard_count + 1;
-         break;
-      }
+// the deals by score, freqs[score] for score 0 to SCORES - 1; returns HAND_COUNT
+int count_deals(int64_t freqs[SCORES]) {
+    for (uint8_t s = 0; s < SCORES; s++) {
+        freqs[s] = 0;
     }
-    if (!run_length) { // no run found yet
-       // check if there is a card to make a better rank to replace the lowest_wildcard in the N of a kind
-       if (second_lowest_wildcard) {
-         run_rank = wildcard_rank(second_lowest_wildcard);
-         for (i = 4 - wildcard_count; i >= 0; i--) {
-            if (hnd[i] <= run_rank) {
-               run_rank = hnd[i];
-               run_length = wildcard_count;
-               break;
-            }
-         }
-       }
-       if (!run_length) {
-         run_rank = wildcard_rank(lowest_wildcard);
-         run_length = wildcard_count;
-       }
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        freqs[SCORE_TABLE[rank]]++;
     }
-   }
+    return HAND_COUNT;
+}
 
-   int straight_rank = 0;
-   if (is_flush) { // straight without wildcards is always a straight flush
-      if (hnd[0] == (hnd[4] - 4)) {
-         straight_rank = hnd[4];
-      } else if (hnd[0] == CA && hnd[1] == CT) {
-         straight_rank = CAHigh;
-      }
-   } else { // straight with wildcards
-     if (hnd[0] == CA) {
-       if ((lowest_wildcard == WT && hnd[1] >= CJ) ||
-           (lowest_wildcard == WK && hnd[1] >= CT)) {
-         straight_rank = CAHigh;
-       }
-     }
-     if (!straight_rank) {
-       int highest_suit_card = hnd[4 - wildcard_count];
-       if ((highest_suit_card - hnd[0]) <= 4) { // highest and lowest non-wildcard can form a straight
-         int straight_rank_low_bound = highest_suit_card >= 5 ? highest_suit_card : 5;
-         for (i = hnd[0] + 4; i >= straight_rank_low_bound; i--) {
-            // try all possible end ranks (from high to low) and see if the available wildcards can fill the gaps
-            int wanted_rank = i;
-            int wanted_rank_low = i - 4;
-            if (lowest_wildcard < wanted_rank_low) {
-               continue;
-            }
-            int suit_i = 4 - wildcard_count;
-            int wildcard_i = 4;
-            int wildcard_i_low_bound = suit_i + 1;
-            while (wanted_rank >= wanted_rank_low) {
-               if (wanted_rank == hnd[suit_i]) {
-                  if (suit_i > 0) {
-                     suit_i--;
-                  };
-               } else if (wanted_rank <= wildcard_rank(hnd[wildcard_i])) {
-                  if (wildcard_i > wildcard_i_low_bound) {
-                     wildcard_i--;
-                  };
-               } else {
-                  break; // no suit or wildcard to be the wanted_rank
-               }
-               wanted_rank--;
+// countDoubleDraw of bird.l: every deal, kept as is and with every 1 to 5 of its cards redrawn in every way
+// from the 12 cards not dealt, HAND_COUNT outcomes a deal. The deals by hand_rank are split over the threads
+// by bird_poker_ranges.h.
+
+typedef struct {
+    pthread_t thread;
+    int64_t freqs[SCORES];
+} double_draw_thread_t;
+
+static double_draw_thread_t *double_draw_threads;
+static ranges_t double_draw_deals;
+
+static void *double_draw_run(void *arg) {
+    double_draw_thread_t *t = arg;
+    // the subsets of the 12 cards not dealt by size, draws_from[k] to draws_from[k + 1] - 1 of draws
+    static const uint16_t draws_from[7] = {0, 1, 13, 79, 299, 794, 1586};
+    uint32_t subsets[1 << 12];
+    uint32_t draws[1586];
+    uint64_t rank;
+    while (ranges_take(&double_draw_deals, t - double_draw_threads, &rank)) {
+        uint32_t dealt = hand_unrank(rank);
+        uint8_t left[12];
+        uint32_t cards = DECK_MASK & ~dealt;
+        for (uint8_t i = 0; i < 12; i++, cards &= cards - 1) {
+            left[i] = __builtin_ctz(cards);
+        }
+        uint16_t at[6];
+        for (uint8_t k = 0; k < 6; k++) {
+            at[k] = draws_from[k];
+        }
+        subsets[0] = 0;
+        draws[at[0]++] = 0;
+        for (uint16_t i = 1; i < 1 << 12; i++) {
+            // the subset of i less its lowest bit, with the card of that bit
+            subsets[i] = subsets[i & (i - 1)] | 1u << left[__builtin_ctz(i)];
+            uint8_t k = __builtin_popcount(i);
+            if (k <= 5) {
+                draws[at[k]++] = subsets[i];
             }
-            if (wanted_rank < wanted_rank_low) {
-               straight_rank = i;
-               break;
+        }
+        for (uint8_t hold = 0; hold < 32; hold++) {
+            uint32_t held = hold_cards(dealt, hold);
+            uint8_t k = 5 - __builtin_popcount(hold);
+            for (uint16_t d = draws_from[k]; d < draws_from[k + 1]; d++) {
+                t->freqs[MASK_SCORES[(held | draws[d]) >> 1]]++;
             }
-         }
-       }
-     }
-   }
-   int combi = 0;
-   int highc = 0;
+        }
+    }
+    return NULL;
+}
 
-   if (is_flush && (straight_rank == CAHigh)) {
-      combi = Royal;
-   } else if (run_length == 5) {
-      combi = FiveK;
-      highc = run_rank;
-   } else if (is_flush && straight_rank) {
-      combi = StrFl;
-      highc = straight_rank;
-   } else if (run_length == 4) {
-      combi = FourK;
-      highc = run_rank;
-   } else if (straight_rank) {
-      combi = Strgt;
-      highc = straight_rank;
-   } else if (is_flush) {
-      combi = Flush;
-      highc = highcard(hnd, 0);
-   } else if (run_length == 3) {
-      combi = Trips;
-      highc = run_rank;
-   } else if (run_length == 2) {
-      combi = OnePr;
-      highc = run_rank;
-   } else {
-      combi = HighC;
-      highc = highcard(hnd, wildcard_count);
-   }
-//   printf("CHand: %d %d %d %d %d Sorted: %d %d %d %d %d\n", h0, h1, h2, h3, h4, hnd[0], hnd[1], hnd[2], hnd[3], hnd[4]);
-//   printf("Combi: %d HighC: %d\n", combi, highc);
-   return ((combi << 4) | highc) ;
+// the outcomes of countDoubleDraw by score into freqs, over threads threads (0 for one per core); returns
+// their number, HAND_COUNT * HAND_COUNT
+int64_t count_double_draw(int64_t freqs[SCORES], int threads) {
+    if (threads <= 0) {
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = threads > 0 ? threads : 1;
+    }
+    double_draw_threads = calloc(threads, sizeof(double_draw_thread_t));
+    ranges_init(&double_draw_deals, threads, HAND_COUNT);
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&double_draw_threads[i].thread, NULL, double_draw_run, &double_draw_threads[i]);
+    }
+    int64_t count = 0;
+    for (uint8_t s = 0; s < SCORES; s++) {
+        freqs[s] = 0;
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(double_draw_threads[i].thread, NULL);
+        for (uint8_t s = 0; s < SCORES; s++) {
+            freqs[s] += double_draw_threads[i].freqs[s];
+            count += double_draw_threads[i].freqs[s];
+        }
+    }
+    ranges_free(&double_draw_deals);
+    free(double_draw_threads);
+    double_draw_threads = NULL;
+    return count;
 }
@@ -0,0 +1,118 @@
+// gcc -O2 -Wall -pthread -I../c check_bird.c bird.c -o check_bird
+//
+// ./check_bird [threads]
+//
+// Checks the native scoring of bird_c.l without pil, through the buffers bird_c.l passes: count_deals against
+// the countComb table of bird.l, score_hands and score_hand over the hands of intHands (every 5 of the 17
+// cards, in its H3 H2 H1 H5 H4 order) against score() of bird_poker_score.h, which scores from the cards
+// rather than from SCORE_TABLE, deals against hand_unrank, and count_double_draw (on threads threads, default
+// one per core) against the countDoubleDraw Freqs of bird.l, Trips split at 7 as checkDoubleDraw does.
+#include <stdio.h>
+#include <stdlib.h>
+#include "bird_poker_score.h"
+
+#define SCORES 160
+
+int score_hand(int h0, int h1, int h2, int h3, int h4);
+int score_hands(const uint8_t *hands, int n, uint8_t *scores);
+int deals(uint8_t *hands);
+int count_deals(int64_t freqs[SCORES]);
+int64_t count_double_draw(int64_t freqs[SCORES], int threads);
+
+// the countComb table of bird.l by combi
+static const int64_t COMB_FREQS[10] = {0, 139, 2884, 1327, 1277, 349, 198, 9, 4, 1};
+
+// the countDoubleDraw Freqs of bird.l by combi, Trips 7 and up in TRIPS_HIGH and the rest in Trips
+#define TRIPS_HIGH 0
+static const int64_t DOUBLE_DRAW_FREQS[10] = {1893528, 860132, 17846192, 6317948, 7902076, 2159612, 1225224, 55692, 24752, 6188};
+#define DOUBLE_DRAW_COUNT 38291344
+
+static int compare(const char *what, const int64_t got[10], const int64_t want[10]) {
+    int fails = 0;
+    for (uint8_t combi = 0; combi < 10; combi++) {
+        if (got[combi] != want[combi]) {
+            fprintf(stderr, "%s MISMATCH combi %u: %lld, bird.l has %lld\n", what, combi, (long long) got[combi],
+                    (long long) want[combi]);
+            fails++;
+        }
+    }
+    return fails;
+}
+
+int main(int argc, char *argv[]) {
+    int threads = argc > 1 ? atoi(argv[1]) : 0;
+    int fails = 0;
+
+    int64_t freqs[SCORES];
+    int64_t combis[10] = {0};
+    count_deals(freqs);
+    for (uint8_t s = 0; s < SCORES; s++) {
+        combis[s >> 4] += freqs[s];
+    }
+    fails += compare("count_deals", combis, COMB_FREQS);
+
+    // the (NIL (Size) . Bytes) buffer of cscores, the hands as intHands makes them
+    static uint8_t hands[HAND_COUNT * 5];
+    static uint8_t scores[HAND_COUNT];
+    int n = 0;
+    for (uint8_t h1 = CA; h1 <= WK - 4; h1++) {
+        for (uint8_t h2 = h1 + 1; h2 <= WK - 3; h2++) {
+            for (uint8_t h3 = h2 + 1; h3 <= WK - 2; h3++) {
+                for (uint8_t h4 = h3 + 1; h4 <= WK - 1; h4++) {
+                    for (uint8_t h5 = h4 + 1; h5 <= WK; h5++, n++) {
+                        uint8_t *hand = &hands[5 * n];
+                        hand[0] = h3;
+                        hand[1] = h2;
+                        hand[2] = h1;
+                        hand[3] = h5;
+                        hand[4] = h4;
+                    }
+                }
+            }
+        }
+    }
+    int invalid = score_hands(hands, n, scores);
+    int hand_fails = invalid != 0;
+    for (int i = 0; i < n; i++) {
+        const uint8_t *hand = &hands[5 * i];
+        int want = score(hand[0], hand[1], hand[2], hand[3], hand[4]);
+        int single = score_hand(hand[0], hand[1], hand[2], hand[3], hand[4]);
+        if (scores[i] != want || single != want) {
+            fprintf(stderr, "score_hands MISMATCH %u %u %u %u %u: %u, score_hand %d, score %d\n", hand[0], hand[1],
+                    hand[2], hand[3], hand[4], scores[i], single, want);
+            hand_fails++;
+        }
+    }
+    // intHands prints (hands fails)
+    printf("(%d %d)\n", n, hand_fails);
+    fails += hand_fails + (n != HAND_COUNT);
+
+    // the (Cards (30940 B . 30940)) buffer of cdeals
+    deals(hands);
+    for (uint16_t rank = 0; rank < HAND_COUNT; rank++) {
+        uint32_t mask = hand_unrank(rank);
+        for (uint8_t i = 0; i < 5; i++, mask &= mask - 1) {
+            if (hands[5 * rank + i] != lowest_bit(mask)) {
+                fprintf(stderr, "deals MISMATCH deal %u card %u: %u\n", rank, i, hands[5 * rank + i]);
+                fails++;
+                break;
+            }
+        }
+    }
+
+    int64_t count = count_double_draw(freqs, threads);
+    int64_t double_draw[10] = {0};
+    for (uint8_t s = 0; s < SCORES; s++) {
+        uint8_t combi = s >> 4;
+        double_draw[combi == Trips && (s & 15) >= 7 ? TRIPS_HIGH : combi] += freqs[s];
+    }
+    fails += compare("count_double_draw", double_draw, DOUBLE_DRAW_FREQS);
+    if (count != DOUBLE_DRAW_COUNT) {
+        fprintf(stderr, "count_double_draw MISMATCH %lld outcomes, bird.l has %d\n", (long long) count, DOUBLE_DRAW_COUNT);
+        fails++;
+    }
+    // checkDoubleDraw prints (Cnt (= Cnt 38291344))
+    printf("(%lld %s)\n", (long long) count, count == DOUBLE_DRAW_COUNT ? "T" : "NIL");
+    printf("%d deals %lld double draws %d fails\n", HAND_COUNT, (long long) count, fails);
+    return fails ? 1 : 0;
+}